@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Rebuilding a code module from an installed one and a patch
+ */
+
+#include "cfs/cfs.h"
+#include "lib/crc16.h"
+
+#include "codeprop-patch.h"
+
+#define BUFSIZE 32
+
+struct reader {
+  int fd;
+  uint8_t buf[BUFSIZE];
+  uint8_t ptr, len;
+};
+
+/*---------------------------------------------------------------------*/
+static int
+read_byte(struct reader *r)
+{
+  if(r->ptr == r->len) {
+    int len = cfs_read(r->fd, r->buf, sizeof(r->buf));
+    if(len <= 0) {
+      return -1;
+    }
+    r->len = len;
+    r->ptr = 0;
+  }
+  return r->buf[r->ptr++];
+}
+/*---------------------------------------------------------------------*/
+static int
+read_u16(struct reader *r)
+{
+  int hi, lo;
+
+  hi = read_byte(r);
+  lo = read_byte(r);
+  if(hi < 0 || lo < 0) {
+    return -1;
+  }
+  return (hi << 8) | lo;
+}
+/*---------------------------------------------------------------------*/
+static int
+file_crc(int fd, uint16_t len, unsigned short *crc)
+{
+  uint8_t buf[BUFSIZE];
+  int n;
+
+  *crc = 0;
+  cfs_seek(fd, 0, CFS_SEEK_SET);
+  while(len > 0) {
+    n = cfs_read(fd, buf, len < sizeof(buf) ? len : sizeof(buf));
+    if(n <= 0) {
+      return 0;
+    }
+    *crc = crc16_data(buf, n, *crc);
+    len -= n;
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------*/
+int
+codeprop_patch_check(const uint8_t *data, int len)
+{
+  return len >= 4 &&
+    data[0] == CODEPROP_PATCH_MAGIC0 &&
+    data[1] == CODEPROP_PATCH_MAGIC1 &&
+    data[2] == CODEPROP_PATCH_MAGIC2 &&
+    data[3] == CODEPROP_PATCH_VERSION;
+}
+/*---------------------------------------------------------------------*/
+int
+codeprop_patch_apply(int oldfd, int patchfd, int newfd)
+{
+  struct reader r;
+  uint8_t buf[BUFSIZE];
+  uint8_t magic[4];
+  int i, op, offset;
+  uint16_t old_len, new_len, written;
+  unsigned short old_crc, new_crc, crc;
+  int n, len;
+
+  r.fd = patchfd;
+  r.ptr = r.len = 0;
+  cfs_seek(patchfd, 0, CFS_SEEK_SET);
+
+  for(i = 0; i < sizeof(magic); i++) {
+    magic[i] = read_byte(&r);
+  }
+  if(!codeprop_patch_check(magic, sizeof(magic))) {
+    return CODEPROP_PATCH_BAD_HEADER;
+  }
+  old_len = read_u16(&r);
+  old_crc = read_u16(&r);
+  new_len = read_u16(&r);
+  new_crc = read_u16(&r);
+
+  if(!file_crc(oldfd, old_len, &crc) || crc != old_crc) {
+    return CODEPROP_PATCH_WRONG_BASE;
+  }
+
+  cfs_seek(newfd, 0, CFS_SEEK_SET);
+  written = 0;
+  crc = 0;
+  while(written < new_len) {
+    op = read_byte(&r);
+    if(op < 0) {
+      return CODEPROP_PATCH_CORRUPT;
+    }
+
+    if(op & CODEPROP_PATCH_OP_COPY) {
+      len = (op & 0x7f) + CODEPROP_PATCH_MIN_COPY;
+      offset = read_u16(&r);
+      if(offset < 0 || offset + len > old_len) {
+        return CODEPROP_PATCH_CORRUPT;
+      }
+      cfs_seek(oldfd, offset, CFS_SEEK_SET);
+    } else {
+      len = op + 1;
+    }
+    if(written + len > new_len) {
+      return CODEPROP_PATCH_CORRUPT;
+    }
+
+    while(len > 0) {
+      if(op & CODEPROP_PATCH_OP_COPY) {
+        n = cfs_read(oldfd, buf, len < sizeof(buf) ? len : sizeof(buf));
+        if(n <= 0) {
+          return CODEPROP_PATCH_CORRUPT;
+        }
+      } else {
+        for(n = 0; n < len && n < sizeof(buf); n++) {
+          i = read_byte(&r);
+          if(i < 0) {
+            return CODEPROP_PATCH_CORRUPT;
+          }
+          buf[n] = i;
+        }
+      }
+      if(cfs_write(newfd, buf, n) != n) {
+        return CODEPROP_PATCH_WRITE_FAILED;
+      }
+      crc = crc16_data(buf, n, crc);
+      written += n;
+      len -= n;
+    }
+  }
+
+  if(crc != new_crc) {
+    return CODEPROP_PATCH_BAD_RESULT;
+  }
+  return CODEPROP_PATCH_OK;
+}
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Rebuilding a code module from an installed one and a patch
+ *
+ *         A patch describes a new module as a sequence of COPY and
+ *         ADD operations against the module that is already
+ *         installed. Patches are produced on the host with
+ *         tools/codeprop-diff.
+ *
+ *         Patch format (all 16-bit values are big endian):
+ *
+ *         +------------+-----------+-----------+-----------+-----------+
+ *         | magic (4)  |old len (2)|old crc (2)|new len (2)|new crc (2)|
+ *         +------------+-----------+-----------+-----------+-----------+
+ *         | operations ...
+ *         +---------------------------------------------------------
+ *
+ *         0x00 - 0x7f: ADD, followed by (op + 1) literal bytes
+ *         0x80 - 0xff: COPY (op & 0x7f) + 4 bytes, followed by the
+ *                      16-bit offset of the bytes in the old module
+ */
+
+#ifndef __CODEPROP_PATCH_H__
+#define __CODEPROP_PATCH_H__
+
+#include "contiki.h"
+
+#define CODEPROP_PATCH_MAGIC0 0x7f
+#define CODEPROP_PATCH_MAGIC1 'P'
+#define CODEPROP_PATCH_MAGIC2 'T'
+#define CODEPROP_PATCH_VERSION 1
+
+#define CODEPROP_PATCH_HDR_SIZE 12
+
+#define CODEPROP_PATCH_OP_COPY     0x80
+#define CODEPROP_PATCH_MIN_COPY    4
+#define CODEPROP_PATCH_MAX_COPY    (0x7f + CODEPROP_PATCH_MIN_COPY)
+#define CODEPROP_PATCH_MAX_ADD     0x80
+
+#define CODEPROP_PATCH_OK           0
+#define CODEPROP_PATCH_BAD_HEADER   1
+#define CODEPROP_PATCH_WRONG_BASE   2
+#define CODEPROP_PATCH_CORRUPT      3
+#define CODEPROP_PATCH_WRITE_FAILED 4
+#define CODEPROP_PATCH_BAD_RESULT   5
+
+/**
+ * \brief      Check if data is the start of a patch
+ * \param data The first bytes of a received module or patch
+ * \param len  The number of bytes in data
+ * \return     Non-zero if data starts with the patch magic
+ */
+int codeprop_patch_check(const uint8_t *data, int len);
+
+/**
+ * \brief      Build a new module from the installed one and a patch
+ * \param oldfd  CFS file descriptor of the installed module
+ * \param patchfd CFS file descriptor of the patch
+ * \param newfd  CFS file descriptor to write the new module to
+ * \return     CODEPROP_PATCH_OK, or one of the CODEPROP_PATCH_ error codes
+ *
+ *             The installed module is verified against the length and
+ *             CRC in the patch header before anything is written, and
+ *             the new module against the length and CRC of the new
+ *             module afterwards. The new module must be written to a
+ *             different file than the installed one, since COPY
+ *             operations may refer to any part of it.
+ */
+int codeprop_patch_apply(int oldfd, int patchfd, int newfd);
+
+#endif /* __CODEPROP_PATCH_H__ */
@@ -62,6 +62,16 @@
  *    binary where the NACK pointed to. (This is *not* very efficient,
  *    but simple to implement...)
  *
+ *    Instead of a full module, a patch made by tools/codeprop-diff
+ *    can be sent. It is recognized by its magic bytes, stored in a
+ *    separate file, and propagated as is. The new module is then
+ *    rebuilt from the installed one (see codeprop-patch.h) before it
+ *    is loaded.
+ *
+ *    A module converted by tools/elf2stream is linked as it arrives
+ *    over TCP (see elfloader-stream.h) and started when the last byte
+ *    is in. It is neither stored nor propagated.
+ *
  * States:
  *
  *  Receiving code header -> receiving code -> sending code
@@ -72,8 +82,10 @@
 
 #include "contiki-net.h"
 #include "cfs/cfs.h"
+#include "loader/elfloader-stream.h"
 #include "codeprop-tmp.h"
 #include "loader/elfloader.h"
+#include "codeprop-patch.h"
 #include <string.h>
 
 static const char *err_msgs[] =
@@ -141,7 +153,33 @@ struct codeprop_state {
   struct pt recv_udpthread_pt;
 };
 
-static int fd;
+/* The installed module, and the file being received or sent: either
+   the same file or the patch file. */
+static int fd, rxfd;
+
+/* The module alternates between two files when it is patched, so that
+   the installed one is intact while the new one is built. The index of
+   the installed file is kept in INDEX_NAME so that it survives a
+   reboot. */
+static const char *image_names[] = {"codeprop-image", "codeprop-image2"};
+static uint8_t image;
+
+#define INDEX_NAME "codeprop-index"
+
+/* The first bytes of an incoming file, which tell a streamed module
+   and a patch from a plain module. They are buffered until they have
+   all arrived, since the first segment may be shorter. */
+#define HEADER_LEN 4
+static uint8_t header[HEADER_LEN];
+
+#define PATCH_NAME "codeprop-patch"
+
+static const char patch_err_msg[] = "Patch failed\r\n";
+static const char stream_err_msg[] = "Bad stream\r\n";
+
+/* Set while a streamed module is being received over TCP. */
+static uint8_t streaming;
+static int stream_err;
 
 static struct uip_udp_conn *udp_conn;
 
@@ -160,6 +198,44 @@ codeprop_set_rate(clock_time_t time)
   send_time = time;
 }
 /*---------------------------------------------------------------------*/
+static uint8_t
+read_index(void)
+{
+  int indexfd;
+  uint8_t index;
+
+  index = 0;
+  indexfd = cfs_open(INDEX_NAME, CFS_READ);
+  if(indexfd >= 0) {
+    if(cfs_read(indexfd, &index, 1) != 1 || index > 1) {
+      index = 0;
+    }
+    cfs_close(indexfd);
+  } else {
+    /* No index was written yet: use whichever image exists. */
+    indexfd = cfs_open(image_names[1], CFS_READ);
+    if(indexfd >= 0) {
+      cfs_close(indexfd);
+      index = 1;
+    }
+  }
+  return index;
+}
+/*---------------------------------------------------------------------*/
+static int
+write_index(uint8_t index)
+{
+  int indexfd, len;
+
+  indexfd = cfs_open(INDEX_NAME, CFS_WRITE);
+  if(indexfd < 0) {
+    return 0;
+  }
+  len = cfs_write(indexfd, &index, 1);
+  cfs_close(indexfd);
+  return len == 1;
+}
+/*---------------------------------------------------------------------*/
 PROCESS_THREAD(codeprop_process, ev, data)
 {
   PROCESS_BEGIN();
@@ -182,7 +258,8 @@ PROCESS_THREAD(codeprop_process, ev, data)
   s.addr = 0;
   s.len = 0;
 
-  fd = cfs_open("codeprop-image", CFS_READ | CFS_WRITE);
+  image = read_index();
+  fd = rxfd = cfs_open(image_names[image], CFS_READ | CFS_WRITE);
 
   while(1) {
 
@@ -198,6 +275,108 @@ PROCESS_THREAD(codeprop_process, ev, data)
   PROCESS_END();
 }
 /*---------------------------------------------------------------------*/
+/* Called with the first bytes of an incoming module or patch. */
+static void
+begin_receive(const uint8_t *data, int len)
+{
+  if(rxfd != fd) {
+    cfs_close(rxfd);
+    rxfd = fd;
+  }
+  streaming = s.state == STATE_RECEIVING_TCPDATA &&
+    elfloader_stream_check(data, len);
+  if(streaming) {
+    codeprop_exit_program();
+    elfloader_stream_init();
+    stream_err = ELFLOADER_STREAM_MORE;
+  } else if(codeprop_patch_check(data, len)) {
+    cfs_remove(PATCH_NAME);
+    rxfd = cfs_open(PATCH_NAME, CFS_READ | CFS_WRITE);
+  } else {
+    rxfd = fd;
+  }
+}
+/*---------------------------------------------------------------------*/
+/* Called when a module or patch has been received. If it was a patch,
+   the new module is built next to the installed one, which it then
+   replaces. */
+static int
+finish_receive(void)
+{
+  int newfd, err;
+
+  if(rxfd == fd) {
+    return CODEPROP_PATCH_OK;
+  }
+
+  cfs_remove(image_names[!image]);
+  newfd = cfs_open(image_names[!image], CFS_READ | CFS_WRITE);
+  err = codeprop_patch_apply(fd, rxfd, newfd);
+  PRINTF(("codeprop: patch result %d\n", err));
+  if(err != CODEPROP_PATCH_OK) {
+    cfs_close(newfd);
+    cfs_remove(image_names[!image]);
+    return err;
+  }
+
+  /* Switch the index before removing the old image, so that a reboot
+     at any point leaves the index naming a complete image. */
+  if(!write_index(!image)) {
+    cfs_close(newfd);
+    cfs_remove(image_names[!image]);
+    return CODEPROP_PATCH_WRITE_FAILED;
+  }
+  cfs_close(fd);
+  cfs_remove(image_names[image]);
+  image = !image;
+  fd = newfd;
+  return CODEPROP_PATCH_OK;
+}
+/*---------------------------------------------------------------------*/
+static void
+store(const uint8_t *data, u16_t addr, int len)
+{
+  if(streaming) {
+    /* Only the first error is kept, as the loader reports a bad
+       format for everything after it. */
+    if(stream_err == ELFLOADER_STREAM_MORE) {
+      stream_err = elfloader_stream_input(data, len);
+    }
+  } else {
+    cfs_seek(rxfd, addr, CFS_SEEK_SET);
+    cfs_write(rxfd, data, len);
+  }
+}
+/*---------------------------------------------------------------------*/
+/* Stores the next len bytes of the incoming file at s.addr. The first
+   HEADER_LEN bytes are held back until begin_receive() has seen them
+   all, or the whole file if it is shorter. */
+static void
+receive(const uint8_t *data, int len)
+{
+  int n;
+
+  if(s.addr < HEADER_LEN) {
+    n = HEADER_LEN - s.addr;
+    if(n > len) {
+      n = len;
+    }
+    memcpy(&header[s.addr], data, n);
+    s.addr += n;
+    data += n;
+    len -= n;
+    if(s.addr < HEADER_LEN && s.addr < s.len) {
+      return;
+    }
+    begin_receive(header, s.addr);
+    store(header, 0, s.addr);
+  }
+  if(len > 0) {
+    store(data, s.addr, len);
+    s.addr += len;
+  }
+}
+/*---------------------------------------------------------------------*/
 static u16_t
 send_udpdata(struct codeprop_udphdr *uh)
 {
@@ -213,8 +392,8 @@ send_udpdata(struct codeprop_udphdr *uh)
     len = s.len - s.addr;
   }
 
-  cfs_seek(fd, s.addr, CFS_SEEK_SET);
-  cfs_read(fd, &uh->data[0], len);
+  cfs_seek(rxfd, s.addr, CFS_SEEK_SET);
+  cfs_read(rxfd, &uh->data[0], len);
   /*  eeprom_read(EEPROMFS_ADDR_CODEPROP + s.addr,
       &uh->data[0], len);*/
 
@@ -320,15 +499,11 @@ PT_THREAD(recv_udpthread(struct pt *pt))
 	if(len > 0) {
 	  /*	  eeprom_write(EEPROMFS_ADDR_CODEPROP + s.addr,
 		  &uh->data[0], len);*/
-	  cfs_seek(fd, s.addr, CFS_SEEK_SET);
-	  cfs_write(fd, &uh->data[0], len);
+	  receive(&uh->data[0], len);
 
 	  /*	  beep();*/
-	  PRINTF(("Saved %d bytes at address %d, %d bytes left\n",
-		  uip_datalen() - UDPHEADERSIZE, s.addr,
-		  s.len - s.addr));
-
-	  s.addr += len;
+	  PRINTF(("Saved %d bytes, %d bytes left\n",
+		  uip_datalen() - UDPHEADERSIZE, s.len - s.addr));
 	}
 
       } else if(uip_htons(uh->addr) > s.addr) {
@@ -357,7 +532,9 @@ PT_THREAD(recv_udpthread(struct pt *pt))
     /*    leds_off(LEDS_YELLOW);
 	  beep_quick(2);*/
     /*    printf("Received entire bunary over udr\n");*/
-    codeprop_start_program();
+    if(finish_receive() == CODEPROP_PATCH_OK) {
+      codeprop_start_program();
+    }
     PT_EXIT(pt);
   }
 
@@ -406,9 +583,7 @@ PT_THREAD(recv_tcpthread(struct pt *pt))
 	/*	eeprom_write(EEPROMFS_ADDR_CODEPROP + s.addr,
 		uip_appdata,
 		uip_datalen());*/
-	cfs_seek(fd, s.addr, CFS_SEEK_SET);
-	cfs_write(fd, uip_appdata, uip_datalen());
-	s.addr += datalen;
+	receive(uip_appdata, datalen);
       }
       if(s.addr < s.len) {
 	PT_YIELD_UNTIL(pt, uip_newdata());
@@ -419,12 +594,25 @@ PT_THREAD(recv_tcpthread(struct pt *pt))
     
     {
       static int err;
-      
-      err = codeprop_start_program();
-      
+      static const char *msg;
+
+      if(streaming) {
+	err = stream_err;
+	if(err == ELFLOADER_OK) {
+	  autostart_start(elfloader_autostart_processes);
+	}
+	msg = err >= 0 && err < sizeof(err_msgs) / sizeof(err_msgs[0]) ?
+	  err_msgs[err] : stream_err_msg;
+      } else if(finish_receive() != CODEPROP_PATCH_OK) {
+	msg = patch_err_msg;
+      } else {
+	err = codeprop_start_program();
+	msg = err_msgs[err];
+      }
+
       /* Print out the "OK"/error message. */
       do {
-	uip_send(err_msgs[err], strlen(err_msgs[err]));
+	uip_send(msg, strlen(msg));
 	PT_WAIT_UNTIL(pt, uip_acked() || uip_rexmit() || uip_closed());
       } while(uip_rexmit());
       
@@ -432,11 +620,13 @@ PT_THREAD(recv_tcpthread(struct pt *pt))
       uip_close();
     }
 #endif
-    ++s.id;
-    s.state = STATE_SENDING_UDPDATA;
-    tcpip_poll_udp(udp_conn);
+    if(!streaming) {
+      ++s.id;
+      s.state = STATE_SENDING_UDPDATA;
+      tcpip_poll_udp(udp_conn);
 
-    PT_WAIT_UNTIL(pt, s.state != STATE_SENDING_UDPDATA);
+      PT_WAIT_UNTIL(pt, s.state != STATE_SENDING_UDPDATA);
+    }
     /*    printf("recv_tcpthread: unblocked\n");*/
   }
 
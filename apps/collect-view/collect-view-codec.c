@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Compact encoding of collect view reports
+ */
+
+#include "collect-view-codec.h"
+
+#include <string.h>
+
+#define NUM_FIELDS (sizeof(struct collect_view_data_msg) / sizeof(uint16_t))
+/* The len field is implied and not encoded. */
+#define FIRST_FIELD 1
+#define BITMAP_LEN ((NUM_FIELDS - FIRST_FIELD + 7) / 8)
+
+#define FLAG_REF  0x01
+#define FLAG_LAST 0x02
+
+#define FIELD(msg, i) (((uint16_t *)(msg))[i])
+
+#ifdef COLLECT_VIEW_CONF_DECODERS
+#define NUM_DECODERS COLLECT_VIEW_CONF_DECODERS
+#else /* COLLECT_VIEW_CONF_DECODERS */
+#define NUM_DECODERS 8
+#endif /* COLLECT_VIEW_CONF_DECODERS */
+
+static struct {
+  rimeaddr_t sender;
+  uint8_t age;
+  struct collect_view_decoder d;
+} decoders[NUM_DECODERS];
+
+/*---------------------------------------------------------------------------*/
+static int
+put_varint(uint8_t *buf, int len, int pos, uint16_t v)
+{
+  do {
+    if(pos >= len) {
+      return -1;
+    }
+    buf[pos++] = (v & 0x7f) | (v > 0x7f ? 0x80 : 0);
+    v >>= 7;
+  } while(v != 0);
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+static int
+get_varint(const uint8_t *buf, int len, int pos, uint16_t *v)
+{
+  uint8_t shift;
+
+  *v = 0;
+  for(shift = 0; shift < 21; shift += 7) {
+    if(pos >= len) {
+      return -1;
+    }
+    *v |= (uint16_t)(buf[pos] & 0x7f) << shift;
+    if((buf[pos++] & 0x80) == 0) {
+      return pos;
+    }
+  }
+  return -1;
+}
+/*---------------------------------------------------------------------------*/
+void
+collect_view_encoder_init(struct collect_view_encoder *e,
+                          uint8_t keyframe_interval)
+{
+  memset(e, 0, sizeof(*e));
+  e->keyframe_interval = keyframe_interval;
+}
+/*---------------------------------------------------------------------------*/
+int
+collect_view_encode(struct collect_view_encoder *e,
+                    const struct collect_view_data_msg *msg,
+                    uint8_t *buf, int len)
+{
+  uint8_t keyframe;
+  uint16_t v;
+  int pos, bitmap;
+  unsigned i;
+
+  keyframe = e->since_keyframe == 0;
+  if(len < 3 + BITMAP_LEN) {
+    return 0;
+  }
+
+  e->seqno++;
+  buf[0] = keyframe ? COLLECT_VIEW_KEYFRAME : COLLECT_VIEW_DELTA;
+  buf[1] = e->seqno;
+  pos = 2;
+  if(!keyframe) {
+    buf[pos++] = e->ref_seqno;
+  }
+  bitmap = pos;
+  memset(&buf[bitmap], 0, BITMAP_LEN);
+  pos += BITMAP_LEN;
+
+  for(i = FIRST_FIELD; i < NUM_FIELDS; i++) {
+    if(keyframe) {
+      v = FIELD(msg, i);
+    } else {
+      /* Zigzag encode the difference so that small decreases are
+         as short as small increases. */
+      v = FIELD(msg, i) - FIELD(&e->ref, i);
+      v = (v << 1) ^ ((v & 0x8000) ? 0xffff : 0);
+    }
+    if(v != 0) {
+      buf[bitmap + (i - FIRST_FIELD) / 8] |= 1 << ((i - FIRST_FIELD) % 8);
+      pos = put_varint(buf, len, pos, v);
+      if(pos < 0) {
+        e->seqno--;
+        return 0;
+      }
+    }
+  }
+
+  memcpy(&e->last, msg, sizeof(e->last));
+  if(keyframe) {
+    memcpy(&e->ref, msg, sizeof(e->ref));
+    e->ref_seqno = e->seqno;
+  }
+  e->since_keyframe++;
+  if(e->since_keyframe >= e->keyframe_interval) {
+    e->since_keyframe = 0;
+  }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+void
+collect_view_encoder_ack(struct collect_view_encoder *e, uint8_t seqno)
+{
+  if(seqno == e->seqno && e->ref_seqno != seqno) {
+    memcpy(&e->ref, &e->last, sizeof(e->ref));
+    e->ref_seqno = seqno;
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+collect_view_decoder_init(struct collect_view_decoder *d)
+{
+  memset(d, 0, sizeof(*d));
+}
+/*---------------------------------------------------------------------------*/
+int
+collect_view_decode(struct collect_view_decoder *d,
+                    const uint8_t *buf, int len,
+                    struct collect_view_data_msg *msg)
+{
+  uint8_t keyframe, seqno;
+  const uint8_t *bitmap;
+  uint16_t v;
+  int pos;
+  unsigned i;
+
+  if(len < 2 || (buf[0] != COLLECT_VIEW_KEYFRAME &&
+                 buf[0] != COLLECT_VIEW_DELTA)) {
+    return 0;
+  }
+  keyframe = buf[0] == COLLECT_VIEW_KEYFRAME;
+  seqno = buf[1];
+  pos = 2;
+
+  if(keyframe) {
+    memset(msg, 0, sizeof(*msg));
+  } else {
+    if(len < 3) {
+      return 0;
+    }
+    /* The sender moves its reference to the last report we got once
+       we have acknowledged it. */
+    if((d->flags & FLAG_LAST) && buf[2] == d->last_seqno &&
+       !((d->flags & FLAG_REF) && buf[2] == d->ref_seqno)) {
+      memcpy(&d->ref, &d->last, sizeof(d->ref));
+      d->ref_seqno = d->last_seqno;
+      d->flags |= FLAG_REF;
+    }
+    if(!(d->flags & FLAG_REF) || buf[2] != d->ref_seqno) {
+      return 0;
+    }
+    memcpy(msg, &d->ref, sizeof(*msg));
+    pos++;
+  }
+
+  if(len < pos + (int)BITMAP_LEN) {
+    return 0;
+  }
+  bitmap = &buf[pos];
+  pos += BITMAP_LEN;
+
+  for(i = FIRST_FIELD; i < NUM_FIELDS; i++) {
+    if(bitmap[(i - FIRST_FIELD) / 8] & (1 << ((i - FIRST_FIELD) % 8))) {
+      pos = get_varint(buf, len, pos, &v);
+      if(pos < 0) {
+        return 0;
+      }
+      if(keyframe) {
+        FIELD(msg, i) = v;
+      } else {
+        v = (v >> 1) ^ ((v & 1) ? 0xffff : 0);
+        FIELD(msg, i) += v;
+      }
+    }
+  }
+  msg->len = NUM_FIELDS;
+
+  memcpy(&d->last, msg, sizeof(d->last));
+  d->last_seqno = seqno;
+  d->flags |= FLAG_LAST;
+  if(keyframe) {
+    memcpy(&d->ref, msg, sizeof(d->ref));
+    d->ref_seqno = seqno;
+    d->flags |= FLAG_REF;
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+int
+collect_view_decode_report(const rimeaddr_t *sender,
+                           const uint8_t *buf, int len,
+                           struct collect_view_data_msg *msg)
+{
+  int i, found, oldest;
+
+  if(len > 0 && buf[0] != COLLECT_VIEW_KEYFRAME &&
+     buf[0] != COLLECT_VIEW_DELTA) {
+    if(len < (int)sizeof(*msg)) {
+      return 0;
+    }
+    memcpy(msg, buf, sizeof(*msg));
+    return 1;
+  }
+
+  /* Find the decoder of the sender, or take over the one that has
+     gone unused the longest. */
+  found = -1;
+  oldest = 0;
+  for(i = 0; i < NUM_DECODERS; i++) {
+    if(decoders[i].age < 0xff) {
+      decoders[i].age++;
+    }
+    if(rimeaddr_cmp(&decoders[i].sender, sender)) {
+      found = i;
+    }
+    if(decoders[i].age > decoders[oldest].age) {
+      oldest = i;
+    }
+  }
+  if(found < 0) {
+    found = oldest;
+    rimeaddr_copy(&decoders[found].sender, sender);
+    collect_view_decoder_init(&decoders[found].d);
+  }
+  decoders[found].age = 0;
+
+  return collect_view_decode(&decoders[found].d, buf, len, msg);
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Compact encoding of collect view reports
+ *
+ *         Instead of the full struct collect_view_data_msg, a report
+ *         can be sent as either a keyframe or a delta. A keyframe
+ *         holds all non-zero fields. A delta holds only the fields
+ *         that differ from a reference report, as the difference
+ *         from the reference. Values are written as varints of 7
+ *         bits per byte, so small values and small changes take
+ *         a single byte.
+ *
+ *         The reference is the last keyframe, or a later report
+ *         that the receiver has acknowledged with
+ *         collect_view_encoder_ack(). A keyframe is sent every
+ *         keyframe_interval reports, so a receiver that has missed
+ *         the reference can decode again after that.
+ *
+ *         The first byte of an encoded report is
+ *         COLLECT_VIEW_KEYFRAME or COLLECT_VIEW_DELTA. Neither can
+ *         be the first byte of a full struct collect_view_data_msg,
+ *         so receivers can accept both formats.
+ *
+ *         The decoder only depends on this header, so it can also
+ *         be used by sinks running on the native platform.
+ */
+
+#ifndef COLLECT_VIEW_CODEC_H
+#define COLLECT_VIEW_CODEC_H
+
+#include "collect-view.h"
+
+#define COLLECT_VIEW_KEYFRAME 0xc1
+#define COLLECT_VIEW_DELTA    0xc2
+
+struct collect_view_encoder {
+  struct collect_view_data_msg ref, last;
+  uint8_t seqno, ref_seqno;
+  uint8_t since_keyframe, keyframe_interval;
+};
+
+struct collect_view_decoder {
+  struct collect_view_data_msg ref, last;
+  uint8_t ref_seqno, last_seqno;
+  uint8_t flags;
+};
+
+/**
+ * \brief      Initialize an encoder
+ * \param e    A pointer to a struct collect_view_encoder
+ * \param keyframe_interval The number of reports between keyframes
+ */
+void collect_view_encoder_init(struct collect_view_encoder *e,
+                               uint8_t keyframe_interval);
+
+/**
+ * \brief      Encode a report
+ * \param e    A pointer to a struct collect_view_encoder
+ * \param msg  The report
+ * \param buf  The output buffer
+ * \param len  The size of the output buffer
+ * \return     The length of the encoded report, or 0 if the buffer
+ *             is too small
+ */
+int collect_view_encode(struct collect_view_encoder *e,
+                        const struct collect_view_data_msg *msg,
+                        uint8_t *buf, int len);
+
+/**
+ * \brief      Tell the encoder that the receiver got a report
+ * \param e    A pointer to a struct collect_view_encoder
+ * \param seqno The sequence number of the report, the second byte
+ *             of the encoded report
+ *
+ *             If seqno is the last report sent, it becomes the
+ *             reference for the following deltas.
+ */
+void collect_view_encoder_ack(struct collect_view_encoder *e, uint8_t seqno);
+
+/**
+ * \brief      Initialize a decoder, one for each sender
+ * \param d    A pointer to a struct collect_view_decoder
+ */
+void collect_view_decoder_init(struct collect_view_decoder *d);
+
+/**
+ * \brief      Decode a report
+ * \param d    A pointer to the struct collect_view_decoder of the sender
+ * \param buf  The encoded report
+ * \param len  The length of the encoded report
+ * \param msg  The decoded report
+ * \return     1 if the report was decoded, 0 if it is malformed or
+ *             refers to a report that the decoder has not seen
+ */
+int collect_view_decode(struct collect_view_decoder *d,
+                        const uint8_t *buf, int len,
+                        struct collect_view_data_msg *msg);
+
+/**
+ * \brief      Decode a report in either format from one of several senders
+ * \param sender The sender of the report
+ * \param buf  The report, compact or a full struct collect_view_data_msg
+ * \param len  The length of the report
+ * \param msg  The decoded report
+ * \return     1 if the report was decoded, 0 otherwise
+ *
+ *             Keeps a decoder for each of the last
+ *             COLLECT_VIEW_CONF_DECODERS senders. This is what a sink
+ *             uses to turn reports back into full structs.
+ */
+int collect_view_decode_report(const rimeaddr_t *sender,
+                               const uint8_t *buf, int len,
+                               struct collect_view_data_msg *msg);
+
+#endif /* COLLECT_VIEW_CODEC_H */
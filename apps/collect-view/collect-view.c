@@ -43,9 +43,20 @@
 #include "net/rime.h"
 #include "net/rime/timesynch.h"
 #include "collect-view.h"
+#include "collect-view-codec.h"
 
 #include <string.h>
 
+#ifdef COLLECT_VIEW_CONF_KEYFRAME_INTERVAL
+#define KEYFRAME_INTERVAL COLLECT_VIEW_CONF_KEYFRAME_INTERVAL
+#else /* COLLECT_VIEW_CONF_KEYFRAME_INTERVAL */
+#define KEYFRAME_INTERVAL 10
+#endif /* COLLECT_VIEW_CONF_KEYFRAME_INTERVAL */
+
+#if COLLECT_VIEW_COMPACT
+static struct collect_view_encoder encoder;
+#endif /* COLLECT_VIEW_COMPACT */
+
 /*---------------------------------------------------------------------------*/
 void
 collect_view_construct_message(struct collect_view_data_msg *msg,
@@ -104,3 +115,30 @@ collect_view_construct_message(struct collect_view_data_msg *msg,
   collect_view_arch_read_sensors(msg);
 }
 /*---------------------------------------------------------------------------*/
+int
+collect_view_construct_report(uint8_t *buf, int len,
+                              rimeaddr_t *parent,
+                              uint16_t parent_etx,
+                              uint16_t current_rtmetric,
+                              uint16_t num_neighbors,
+                              uint16_t beacon_interval)
+{
+  struct collect_view_data_msg msg;
+
+  collect_view_construct_message(&msg, parent, parent_etx,
+                                 current_rtmetric, num_neighbors,
+                                 beacon_interval);
+#if COLLECT_VIEW_COMPACT
+  if(encoder.keyframe_interval == 0) {
+    collect_view_encoder_init(&encoder, KEYFRAME_INTERVAL);
+  }
+  return collect_view_encode(&encoder, &msg, buf, len);
+#else /* COLLECT_VIEW_COMPACT */
+  if(len < (int)sizeof(msg)) {
+    return 0;
+  }
+  memcpy(buf, &msg, sizeof(msg));
+  return sizeof(msg);
+#endif /* COLLECT_VIEW_COMPACT */
+}
+/*---------------------------------------------------------------------------*/
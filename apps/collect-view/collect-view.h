@@ -22,6 +22,26 @@ struct collect_view_data_msg {
   uint16_t sensors[10];
 };
 
+/* With COLLECT_VIEW_CONF_COMPACT, reports are sent in the compact
+   keyframe/delta format of collect-view-codec.h instead of as the
+   full struct. */
+#ifdef COLLECT_VIEW_CONF_COMPACT
+#define COLLECT_VIEW_COMPACT COLLECT_VIEW_CONF_COMPACT
+#else /* COLLECT_VIEW_CONF_COMPACT */
+#define COLLECT_VIEW_COMPACT 0
+#endif /* COLLECT_VIEW_CONF_COMPACT */
+
+/** The largest possible size of a compact report. */
+#define COLLECT_VIEW_CODEC_MAX_LEN                                      \
+  (3 + 3 + 3 * (sizeof(struct collect_view_data_msg) / sizeof(uint16_t)))
+
+/** The largest report built by collect_view_construct_report(). */
+#if COLLECT_VIEW_COMPACT
+#define COLLECT_VIEW_REPORT_MAX_LEN COLLECT_VIEW_CODEC_MAX_LEN
+#else /* COLLECT_VIEW_COMPACT */
+#define COLLECT_VIEW_REPORT_MAX_LEN sizeof(struct collect_view_data_msg)
+#endif /* COLLECT_VIEW_COMPACT */
+
 void collect_view_construct_message(struct collect_view_data_msg *msg,
                                     rimeaddr_t *parent,
                                     uint16_t etx_to_parent,
@@ -29,6 +49,18 @@ void collect_view_construct_message(struct collect_view_data_msg *msg,
                                     uint16_t num_neighbors,
                                     uint16_t beacon_interval);
 
+/**
+ * Construct a report like collect_view_construct_message() and write
+ * it to buf in the format selected by COLLECT_VIEW_CONF_COMPACT.
+ * Returns the length of the report, or 0 if buf is too small.
+ */
+int collect_view_construct_report(uint8_t *buf, int len,
+                                  rimeaddr_t *parent,
+                                  uint16_t etx_to_parent,
+                                  uint16_t current_rtmetric,
+                                  uint16_t num_neighbors,
+                                  uint16_t beacon_interval);
+
 void collect_view_arch_read_sensors(struct collect_view_data_msg *msg);
 
 #endif /* COLLECT_VIEW_H */
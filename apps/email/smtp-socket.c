@@ -36,29 +36,62 @@
 
 #include "smtp-strings.h"
 #include "contiki-net.h"
+#include "cfs/cfs.h"
 
 #include <string.h>
 
+/* Position in the data of the message being sent. */
+struct smtp_pos {
+  u8_t part;
+  u16_t piece;
+  u16_t off;
+  cfs_offset_t fileoff;
+  char bol;
+  char env;
+};
+
+#define PART_HEADER 0
+#define PART_BODY   1
+#define PART_END    2
+#define PART_DONE   3
+
+/* Commands that gen_cmds() puts in one segment. */
+#define CMD_HELO 0x01
+#define CMD_EHLO 0x02
+#define CMD_RSET 0x04
+#define CMD_MAIL 0x08
+#define CMD_RCPT 0x10
+#define CMD_QUIT 0x20
+#define CMD_CC   0x40
+#define CMD_DATA 0x80
+
+#define CMD_ENVELOPE (CMD_MAIL | CMD_RCPT | CMD_CC | CMD_DATA)
+
 struct smtp_state {
 
   char connected;
+  char quit;
+  char pipelining;
+  char rset;
+  char sentenv;
   
   struct psock psock;
 
-  char inputbuffer[4];
-  
-  char *to;
-  char *cc;
-  char *from;
-  char *subject;
-  char *msg;
-  u8_t msgwidth;
-  u8_t msgheight;
-  u8_t line;
+  char inputbuffer[16];
+
+  struct smtp_msg *queue;
+  struct smtp_msg *m, *next, *env;
+  int fd, nextfd;
+  u8_t cmds;
+  unsigned char err, error;
+
+  struct smtp_pos pos, npos;
 };
 
 static struct smtp_state s;
 
+static struct smtp_msg sendmsg;
+
 static char *localhostname;
 static uip_ipaddr_t smtpserver;
 
@@ -66,33 +99,314 @@ static uip_ipaddr_t smtpserver;
 #define ISO_cr 0x0d
 
 #define ISO_period 0x2e
+#define ISO_dash   0x2d
 
 #define ISO_2  0x32
 #define ISO_3  0x33
 #define ISO_4  0x34
 #define ISO_5  0x35
 
+static const char period[2] = {ISO_period, 0};
+
+
+#define SEND_CMDS(s, c) do {                                    \
+    (s)->cmds = (c);                                            \
+    PSOCK_GENERATOR_SEND(&(s)->psock, gen_cmds, NULL);          \
+  } while(0)
+
+/* Reads a reply, skipping the continuation lines of multi-line
+   replies. */
+#define READ_REPLY(s) do {                                      \
+    PSOCK_READTO(&(s)->psock, ISO_nl);                          \
+  } while(PSOCK_DATALEN(&(s)->psock) > 3 &&                    \
+          (s)->inputbuffer[3] == ISO_dash)
+
+/* Records err as the error of the current message if it is the
+   first one and the reply does not start with c. */
+#define CHECK_REPLY(s, c, e) do {                               \
+    if((s)->err == SMTP_ERR_OK && (s)->inputbuffer[0] != (c)) { \
+      (s)->err = (e);                                           \
+    }                                                           \
+  } while(0)
+/*---------------------------------------------------------------------------*/
+/* Copies as much of str as fits at *p. Returns the number of bytes
+   copied. */
+static u16_t
+put(char **p, u16_t *room, const char *str, u16_t len)
+{
+  if(len > *room) {
+    len = *room;
+  }
+  memcpy(*p, str, len);
+  *p += len;
+  *room -= len;
+  return len;
+}
+/*---------------------------------------------------------------------------*/
+static char
+put_str(char **p, u16_t *room, const char *str)
+{
+  u16_t len = strlen(str);
+  return put(p, room, str, len) == len;
+}
+/*---------------------------------------------------------------------------*/
+/* Writes the commands in cmds for message m. Returns 0 if they did
+   not all fit. */
+static char
+put_cmds(char **p, u16_t *room, u8_t cmds, struct smtp_msg *m)
+{
+  char ok = 1;
 
-#define SEND_STRING(s, str) PSOCK_SEND(s, (uint8_t *)str, (unsigned char)strlen(str))
+  if(cmds & (CMD_HELO | CMD_EHLO)) {
+    ok &= put_str(p, room, (cmds & CMD_EHLO)? smtp_ehlo: smtp_helo);
+    ok &= put_str(p, room, localhostname);
+    ok &= put_str(p, room, smtp_crnl);
+  }
+  if(cmds & CMD_RSET) {
+    ok &= put_str(p, room, smtp_rset);
+  }
+  if(cmds & CMD_MAIL) {
+    ok &= put_str(p, room, smtp_mail_from);
+    ok &= put_str(p, room, m->from);
+    ok &= put_str(p, room, smtp_crnl);
+  }
+  if(cmds & CMD_RCPT) {
+    ok &= put_str(p, room, smtp_rcpt_to);
+    ok &= put_str(p, room, m->to);
+    ok &= put_str(p, room, smtp_crnl);
+  }
+  if((cmds & CMD_CC) && *m->cc != 0) {
+    ok &= put_str(p, room, smtp_rcpt_to);
+    ok &= put_str(p, room, m->cc);
+    ok &= put_str(p, room, smtp_crnl);
+  }
+  if(cmds & CMD_DATA) {
+    ok &= put_str(p, room, smtp_data);
+  }
+  if(cmds & CMD_QUIT) {
+    ok &= put_str(p, room, smtp_quit);
+  }
+  return ok;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned short
+gen_cmds(void *arg)
+{
+  char *p = (char *)uip_appdata;
+  u16_t room = uip_mss();
+
+  put_cmds(&p, &room, s.cmds, s.env);
+  return p - (char *)uip_appdata;
+}
+/*---------------------------------------------------------------------------*/
+/* The header lines, one piece at a time. */
+static const char *
+header_piece(u16_t piece)
+{
+  struct smtp_msg *m = s.m;
+
+  switch(piece) {
+  case 0: return smtp_to;
+  case 1: return m->to;
+  case 2: return smtp_crnl;
+  case 3: return *m->cc != 0? smtp_cc: "";
+  case 4: return m->cc;
+  case 5: return *m->cc != 0? smtp_crnl: "";
+  case 6: return smtp_from;
+  case 7: return m->from;
+  case 8: return smtp_crnl;
+  case 9: return smtp_subject;
+  case 10: return m->subject;
+  case 11: return smtp_crnl;
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+/* The lines of a body kept in RAM, each one preceded by a line break
+   and with a leading period doubled. */
+static const char *
+body_piece(u16_t piece)
+{
+  struct smtp_msg *m = s.m;
+  char *line;
+
+  if(piece / 3 >= m->msgheight) {
+    return NULL;
+  }
+  line = &m->msg[(piece / 3) * m->msgwidth];
+  switch(piece % 3) {
+  case 0: return smtp_crnl;
+  case 1: return *line == ISO_period? period: "";
+  }
+  return line;
+}
+/*---------------------------------------------------------------------------*/
+/* Reads the body file into the segment, turning line ends into CRLF
+   and doubling periods at the start of lines. The file is read into
+   the upper half of the segment and expanded downwards, which never
+   overwrites bytes not yet read. Returns -1 at the end of the file. */
+static int
+fill_file(char *p, u16_t room)
+{
+  char *src, *out;
+  u16_t half;
+  int i, n;
+
+  half = room / 2;
+  src = p + room - half;
+  cfs_seek(s.fd, s.npos.fileoff, CFS_SEEK_SET);
+  n = cfs_read(s.fd, src, half);
+  if(n <= 0) {
+    return -1;
+  }
+  out = p;
+  for(i = 0; i < n; i++) {
+    if(src[i] == ISO_cr) {
+      continue;
+    }
+    if(src[i] == ISO_nl) {
+      *out++ = ISO_cr;
+      s.npos.bol = 1;
+    } else {
+      if(s.npos.bol && src[i] == ISO_period) {
+	*out++ = ISO_period;
+      }
+      s.npos.bol = 0;
+    }
+    *out++ = src[i];
+  }
+  s.npos.fileoff += n;
+  return out - p;
+}
+/*---------------------------------------------------------------------------*/
+/* Fills a segment with the message from s.pos on. The position after
+   it is left in s.npos, and becomes s.pos once the segment has been
+   acknowledged, so that a retransmission generates the same data. */
+static unsigned short
+gen_data(void *arg)
+{
+  char *p = (char *)uip_appdata;
+  u16_t room = uip_mss();
+  const char *str;
+  char *mark;
+  u16_t len;
+  int n;
+
+  s.npos = s.pos;
+  while(room > 0 && s.npos.part != PART_DONE) {
+    str = NULL;
+    if(s.npos.part == PART_HEADER) {
+      str = header_piece(s.npos.piece);
+    } else if(s.npos.part == PART_BODY) {
+      if(s.m->msg != NULL) {
+	str = body_piece(s.npos.piece);
+      } else if(s.npos.piece == 0) {
+	/* The empty line that ends the header. */
+	str = smtp_crnl;
+	s.npos.bol = 1;
+      } else {
+	if(room < 2) {
+	  break;
+	}
+	n = fill_file(p, room);
+	if(n >= 0) {
+	  p += n;
+	  room -= n;
+	  continue;
+	}
+      }
+    } else if(s.npos.piece == 0) {
+      /* A body that ends with a line break only needs the period. */
+      str = (s.m->msg == NULL && s.npos.bol)?
+	&smtp_crnlperiodcrnl[2]: smtp_crnlperiodcrnl;
+    } else {
+      /* With pipelining, the commands for the next message go in the
+	 same segment if they fit in full. */
+      if(s.env != NULL) {
+	mark = p;
+	len = room;
+	if(put_cmds(&p, &room, CMD_ENVELOPE, s.env)) {
+	  s.npos.env = 1;
+	} else {
+	  p = mark;
+	  room = len;
+	}
+      }
+      s.npos.part = PART_DONE;
+      break;
+    }
+
+    if(str == NULL) {
+      s.npos.part++;
+      s.npos.piece = 0;
+      s.npos.off = 0;
+      continue;
+    }
+    len = strlen(str);
+    s.npos.off += put(&p, &room, str + s.npos.off, len - s.npos.off);
+    if(s.npos.off == len) {
+      s.npos.piece++;
+      s.npos.off = 0;
+    }
+  }
+  if(s.npos.part == PART_END && s.npos.piece > 0) {
+    /* The end of data marker filled the segment. The next message's
+       commands are sent on their own, as a segment with nothing but
+       them could be empty. */
+    s.npos.part = PART_DONE;
+  }
+  return p - (char *)uip_appdata;
+}
+/*---------------------------------------------------------------------------*/
+/* Returns the first message from m on whose body can be read, with
+   its file opened in *fd. */
+static struct smtp_msg *
+prepare(struct smtp_msg *m, int *fd)
+{
+  for(; m != NULL; m = m->next) {
+    *fd = -1;
+    if(m->msg != NULL) {
+      return m;
+    }
+    *fd = cfs_open(m->file, CFS_READ);
+    if(*fd >= 0) {
+      return m;
+    }
+    m->error = SMTP_ERR_FILE;
+    s.error = SMTP_ERR_FILE;
+  }
+  return NULL;
+}
 /*---------------------------------------------------------------------------*/
 static
 PT_THREAD(smtp_thread(void))
 {
   PSOCK_BEGIN(&s.psock);
 
-  PSOCK_READTO(&s.psock, ISO_nl);
+  READ_REPLY(&s);
    
   if(strncmp(s.inputbuffer, smtp_220, 3) != 0) {
     PSOCK_CLOSE(&s.psock);
     smtp_done(2);
     PSOCK_EXIT(&s.psock);
   }
-  
-  SEND_STRING(&s.psock, (char *)smtp_helo);
-  SEND_STRING(&s.psock, localhostname);
-  SEND_STRING(&s.psock, (char *)smtp_crnl);
 
-  PSOCK_READTO(&s.psock, ISO_nl);
+  /* Servers that do not know EHLO get HELO, and no pipelining. */
+  s.pipelining = 0;
+  SEND_CMDS(&s, CMD_EHLO);
+  do {
+    PSOCK_READTO(&s.psock, ISO_nl);
+    if(PSOCK_DATALEN(&s.psock) >= 4 + sizeof(smtp_pipelining) - 1 &&
+       strncmp(&s.inputbuffer[4], smtp_pipelining,
+	       sizeof(smtp_pipelining) - 1) == 0) {
+      s.pipelining = 1;
+    }
+  } while(PSOCK_DATALEN(&s.psock) > 3 && s.inputbuffer[3] == ISO_dash);
+
+  if(s.inputbuffer[0] != ISO_2) {
+    SEND_CMDS(&s, CMD_HELO);
+    READ_REPLY(&s);
+  }
   
   if(s.inputbuffer[0] != ISO_2) {
     PSOCK_CLOSE(&s.psock);
@@ -100,88 +414,103 @@ PT_THREAD(smtp_thread(void))
     PSOCK_EXIT(&s.psock);
   }  
 
-  SEND_STRING(&s.psock, (char *)smtp_mail_from);
-  SEND_STRING(&s.psock, s.from);
-  SEND_STRING(&s.psock, (char *)smtp_crnl);
-
-  PSOCK_READTO(&s.psock, ISO_nl);
-  
-  if(s.inputbuffer[0] != ISO_2) {
-    PSOCK_CLOSE(&s.psock);
-    smtp_done(4);
-    PSOCK_EXIT(&s.psock);
-  }
+  s.error = SMTP_ERR_OK;
+  s.rset = 0;
+  s.sentenv = 0;
+  s.next = NULL;
+  s.m = prepare(s.queue, &s.fd);
+  while(s.m != NULL) {
+    s.err = SMTP_ERR_OK;
+    s.env = s.m;
 
-  SEND_STRING(&s.psock, (char *)smtp_rcpt_to);
-  SEND_STRING(&s.psock, s.to);
-  SEND_STRING(&s.psock, (char *)smtp_crnl);
+    if(s.pipelining) {
+      /* MAIL, RCPT and DATA go in one segment, unless they were sent
+	 at the end of the previous message. */
+      if(!s.sentenv) {
+	SEND_CMDS(&s, (s.rset? CMD_RSET: 0) | CMD_ENVELOPE);
+      }
+      if(s.rset) {
+	READ_REPLY(&s);
+	s.rset = 0;
+      }
+      READ_REPLY(&s);
+      CHECK_REPLY(&s, ISO_2, 4);
+      READ_REPLY(&s);
+      CHECK_REPLY(&s, ISO_2, 5);
+      if(*s.m->cc != 0) {
+	READ_REPLY(&s);
+	CHECK_REPLY(&s, ISO_2, 6);
+      }
+      READ_REPLY(&s);
+      CHECK_REPLY(&s, ISO_3, 7);
+    } else {
+      if(s.rset) {
+	SEND_CMDS(&s, CMD_RSET);
+	READ_REPLY(&s);
+	s.rset = 0;
+      }
+      SEND_CMDS(&s, CMD_MAIL);
+      READ_REPLY(&s);
+      CHECK_REPLY(&s, ISO_2, 4);
+      if(s.err == SMTP_ERR_OK) {
+	SEND_CMDS(&s, CMD_RCPT);
+	READ_REPLY(&s);
+	CHECK_REPLY(&s, ISO_2, 5);
+	if(*s.m->cc != 0) {
+	  SEND_CMDS(&s, CMD_CC);
+	  READ_REPLY(&s);
+	  CHECK_REPLY(&s, ISO_2, 6);
+	}
+      }
+      if(s.err == SMTP_ERR_OK) {
+	SEND_CMDS(&s, CMD_DATA);
+	READ_REPLY(&s);
+	CHECK_REPLY(&s, ISO_3, 7);
+      }
+    }
 
-  PSOCK_READTO(&s.psock, ISO_nl);
-  
-  if(s.inputbuffer[0] != ISO_2) {
-    PSOCK_CLOSE(&s.psock);
-    smtp_done(5);
-    PSOCK_EXIT(&s.psock);
-  }
-  
-  if(*s.cc != 0) {
-    SEND_STRING(&s.psock, (char *)smtp_rcpt_to);
-    SEND_STRING(&s.psock, s.cc);
-    SEND_STRING(&s.psock, (char *)smtp_crnl);
+    if(s.inputbuffer[0] == ISO_3) {
+      s.env = NULL;
+      if(s.pipelining) {
+	s.next = prepare(s.m->next, &s.nextfd);
+	s.env = s.next;
+      }
+      memset(&s.pos, 0, sizeof(s.pos));
+      do {
+	PSOCK_GENERATOR_SEND(&s.psock, gen_data, NULL);
+	s.pos = s.npos;
+      } while(s.pos.part != PART_DONE);
+      s.sentenv = s.pos.env;
 
-    PSOCK_READTO(&s.psock, ISO_nl);
-  
-    if(s.inputbuffer[0] != ISO_2) {
-      PSOCK_CLOSE(&s.psock);
-      smtp_done(6);
-      PSOCK_EXIT(&s.psock);
+      READ_REPLY(&s);
+      CHECK_REPLY(&s, ISO_2, 8);
+    } else {
+      /* The transaction is left half done on the server. */
+      s.rset = 1;
+      s.sentenv = 0;
     }
-  }
-  
-  SEND_STRING(&s.psock, (char *)smtp_data);
-  
-  PSOCK_READTO(&s.psock, ISO_nl);
-  
-  if(s.inputbuffer[0] != ISO_3) {
-    PSOCK_CLOSE(&s.psock);
-    smtp_done(7);
-    PSOCK_EXIT(&s.psock);
-  }
-
-  SEND_STRING(&s.psock, (char *)smtp_to);
-  SEND_STRING(&s.psock, s.to);
-  SEND_STRING(&s.psock, (char *)smtp_crnl);
-  
-  if(*s.cc != 0) {
-    SEND_STRING(&s.psock, (char *)smtp_cc);
-    SEND_STRING(&s.psock, s.cc);
-    SEND_STRING(&s.psock, (char *)smtp_crnl);
-  }
-  
-  SEND_STRING(&s.psock, (char *)smtp_from);
-  SEND_STRING(&s.psock, s.from);
-  SEND_STRING(&s.psock, (char *)smtp_crnl);
-  
-  SEND_STRING(&s.psock, (char *)smtp_subject);
-  SEND_STRING(&s.psock, s.subject);
-  SEND_STRING(&s.psock, (char *)smtp_crnl);
 
-  for(s.line = 0; s.line < s.msgheight; ++s.line) {
-    SEND_STRING(&s.psock, (char *)smtp_crnl);
-    SEND_STRING(&s.psock, &s.msg[s.line * s.msgwidth]);
-  }
-  
-  SEND_STRING(&s.psock, (char *)smtp_crnlperiodcrnl);
+    if(s.fd >= 0) {
+      cfs_close(s.fd);
+    }
+    s.m->error = s.err;
+    if(s.err != SMTP_ERR_OK) {
+      s.error = s.err;
+    }
 
-  PSOCK_READTO(&s.psock, ISO_nl);
-  if(s.inputbuffer[0] != ISO_2) {
-    PSOCK_CLOSE(&s.psock);
-    smtp_done(8);
-    PSOCK_EXIT(&s.psock);
+    /* Messages may have been queued while this one was sent. */
+    if(s.next == NULL) {
+      s.next = prepare(s.m->next, &s.nextfd);
+      s.sentenv = 0;
+    }
+    s.m = s.next;
+    s.fd = s.nextfd;
+    s.next = NULL;
   }
 
-  SEND_STRING(&s.psock, (char *)smtp_quit);
-  smtp_done(SMTP_ERR_OK);
+  s.quit = 1;
+  SEND_CMDS(&s, CMD_QUIT);
+  smtp_done(s.error);
   PSOCK_END(&s.psock);
 }
 /*---------------------------------------------------------------------------*/
@@ -208,33 +537,59 @@ smtp_configure(char *lhostname, uip_ipaddr_t *server)
 }
 /*---------------------------------------------------------------------------*/
 unsigned char
-smtp_send(char *to, char *cc, char *from, char *subject,
-	  char *msg, u8_t msgwidth, u8_t msgheight)
+smtp_queue(struct smtp_msg *m)
 {
   struct uip_conn *conn;
+  struct smtp_msg **mp;
+
+  m->next = NULL;
+  /* Until the server has accepted it, as if the connection failed. */
+  m->error = 1;
+
+  if(s.connected) {
+    if(s.quit) {
+      return 0;
+    }
+    for(mp = &s.queue; *mp != NULL; mp = &(*mp)->next);
+    *mp = m;
+    return 1;
+  }
 
   conn = tcp_connect(&smtpserver, UIP_HTONS(25), NULL);
   if(conn == NULL) {
     return 0;
   }
   s.connected = 1;
-  s.to = to;
-  s.cc = cc;
-  s.from = from;
-  s.subject = subject;
-  s.msg = msg;
-  s.msgwidth = msgwidth;
-  s.msgheight = msgheight;
+  s.quit = 0;
+  s.queue = m;
 
   PSOCK_INIT(&s.psock, (uint8_t *)s.inputbuffer, sizeof(s.inputbuffer));
   
   return 1;
 }
 /*---------------------------------------------------------------------------*/
+unsigned char
+smtp_send(char *to, char *cc, char *from, char *subject,
+	  char *msg, u8_t msgwidth, u8_t msgheight)
+{
+  if(s.connected) {
+    return 0;
+  }
+  sendmsg.to = to;
+  sendmsg.cc = cc;
+  sendmsg.from = from;
+  sendmsg.subject = subject;
+  sendmsg.msg = msg;
+  sendmsg.msgwidth = msgwidth;
+  sendmsg.msgheight = msgheight;
+  sendmsg.file = NULL;
+
+  return smtp_queue(&sendmsg);
+}
+/*---------------------------------------------------------------------------*/
 void
 smtp_init(void)
 {
   s.connected = 0;
 }
 /*---------------------------------------------------------------------------*/
-
@@ -38,6 +38,9 @@ const char smtp_220[4] =
 const char smtp_helo[6] = 
 /* "HELO " */
 {0x48, 0x45, 0x4c, 0x4f, 0x20, };
+const char smtp_ehlo[6] = 
+/* "EHLO " */
+{0x45, 0x48, 0x4c, 0x4f, 0x20, };
 const char smtp_mail_from[12] = 
 /* "MAIL FROM: " */
 {0x4d, 0x41, 0x49, 0x4c, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x3a, 0x20, };
@@ -62,6 +65,12 @@ const char smtp_subject[10] =
 const char smtp_quit[7] = 
 /* "QUIT\r\n" */
 {0x51, 0x55, 0x49, 0x54, 0xd, 0xa, };
+const char smtp_rset[7] = 
+/* "RSET\r\n" */
+{0x52, 0x53, 0x45, 0x54, 0xd, 0xa, };
+const char smtp_pipelining[11] = 
+/* "PIPELINING" */
+{0x50, 0x49, 0x50, 0x45, 0x4c, 0x49, 0x4e, 0x49, 0x4e, 0x47, };
 const char smtp_crnl[3] = 
 /* "\r\n" */
 {0xd, 0xa, };
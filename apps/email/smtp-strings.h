@@ -34,6 +34,7 @@
  */
 extern const char smtp_220[4];
 extern const char smtp_helo[6];
+extern const char smtp_ehlo[6];
 extern const char smtp_mail_from[12];
 extern const char smtp_rcpt_to[10];
 extern const char smtp_data[7];
@@ -42,5 +43,7 @@ extern const char smtp_cc[5];
 extern const char smtp_from[7];
 extern const char smtp_subject[10];
 extern const char smtp_quit[7];
+extern const char smtp_rset[7];
+extern const char smtp_pipelining[11];
 extern const char smtp_crnl[3];
 extern const char smtp_crnlperiodcrnl[6];
@@ -36,8 +36,25 @@
 
 #include "contiki-net.h"
 
+/* A message to send. The body is either msgheight lines of at most
+   msgwidth characters in msg, or, if msg is NULL, the contents of the
+   CFS file named file. */
+struct smtp_msg {
+  struct smtp_msg *next;
+  char *to;
+  char *cc;
+  char *from;
+  char *subject;
+  char *msg;
+  u8_t msgwidth;
+  u8_t msgheight;
+  char *file;
+  unsigned char error;  /* SMTP_ERR_OK once the message is accepted */
+};
+
 /* Callbacks. */
-#define SMTP_ERR_OK 0
+#define SMTP_ERR_OK   0
+#define SMTP_ERR_FILE 9
 void smtp_done(unsigned char error);
 
 /* Functions. */
@@ -47,6 +64,12 @@ unsigned char smtp_send(char *to, char *cc, char *from,
 			char *subject, char *msg,
 			u8_t msgwidth, u8_t msgheight);
 
+/* Adds a message to the current session, or opens a new session if
+   there is none. All queued messages are sent over the same
+   connection, and smtp_done() is called when the session ends. The
+   message must be kept until then. */
+unsigned char smtp_queue(struct smtp_msg *m);
+
 void smtp_appcall(void *state);
 
 
@@ -197,7 +197,10 @@ static unsigned char ptrstate;
 #define PTRSTATE_REMOTEFILES 1
 static unsigned char localptr, remoteptr;
 
-static int fd = -1;
+static struct ftpc_transfer download;
+/* Set while download is queued or running, as it and the file names
+   it points to must not change until it is done. */
+static unsigned char downloading;
 
 /*---------------------------------------------------------------------------*/
 static void
@@ -256,18 +259,8 @@ show_statustext(char *text1, char *text2)
 }
 /*---------------------------------------------------------------------------*/
 static void
-close_file(void)
-{
-  if(fd != -1) {
-    cfs_close(fd);
-    fd = -1;
-  }
-}
-/*---------------------------------------------------------------------------*/
-static void
 quit(void)
 {
-  close_file();
   ctk_window_close(&window);
   process_exit(&ftp_process);
   LOADER_UNLOAD();
@@ -467,13 +460,17 @@ PROCESS_THREAD(ftp_process, ev, data)
 	ctk_window_open(&window);
 #endif /* CTK_CONF_WINDOWS */
 	ptractive = 1;
-	close_file();
-	fd = cfs_open(localfilename, CFS_WRITE);
-	if(fd != -1) {
-	  show_statustext("Downloading ", remotefilename);
-	  ftpc_get(connection, remotefilename);
+	if(downloading) {
+	  show_statustext("Download in progress", "");
 	} else {
-	  show_statustext("Could not create ", localfilename);
+	  download.localname = localfilename;
+	  download.remotename = remotefilename;
+	  download.dir = FTPC_RETR;
+	  download.offset = 0;
+	  if(ftpc_transfer(connection, &download)) {
+	    downloading = 1;
+	    show_statustext("Downloading ", remotefilename);
+	  }
 	}
       } else if((struct ctk_button *)data == &reloadbutton) {	
 	start_loaddir();
@@ -601,6 +598,7 @@ ftpc_closed(void)
   strcpy(statustext, "Connection closed");
   CTK_WIDGET_REDRAW(&statuslabel);
   connection = NULL;
+  downloading = 0;
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -609,6 +607,7 @@ ftpc_aborted(void)
   strcpy(statustext, "Connection reset");
   CTK_WIDGET_REDRAW(&statuslabel);
   connection = NULL;
+  downloading = 0;
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -617,6 +616,7 @@ ftpc_timedout(void)
   strcpy(statustext, "Connection timed out");
   CTK_WIDGET_REDRAW(&statuslabel);
   connection = NULL;
+  downloading = 0;
 }
 /*---------------------------------------------------------------------------*/
 char *
@@ -674,14 +674,16 @@ ftpc_connected(void *connection)
 }
 /*---------------------------------------------------------------------------*/
 void
-ftpc_data(u8_t *data, u16_t len)
+ftpc_transfer_done(struct ftpc_transfer *t)
 {
-  if(data == NULL) {
+  downloading = 0;
+  if(t->status == FTPC_NOFILE) {
+    show_statustext("Could not create ", t->localname);
+  } else if(t->status == FTPC_DONE) {
     show_statustext("Download complete", "");
-    close_file();
     start_loaddir();
   } else {
-    cfs_write(fd, data, len);
+    show_statustext("Download failed", "");
   }
 }
 /*---------------------------------------------------------------------------*/
@@ -34,6 +34,7 @@
  */
 #include "contiki.h"
 #include "ftpc.h"
+#include "cfs/cfs.h"
 #include "lib/petsciiconv.h"
 
 #include <string.h>
@@ -46,6 +47,14 @@
 
 #define MAX_FILENAMELEN 32
 
+#ifdef FTPC_CONF_MAX_CONNECTIONS
+#define FTPC_MAX_CONNECTIONS FTPC_CONF_MAX_CONNECTIONS
+#else /* FTPC_CONF_MAX_CONNECTIONS */
+#define FTPC_MAX_CONNECTIONS 1
+#endif /* FTPC_CONF_MAX_CONNECTIONS */
+
+struct ftp_connection;
+
 struct ftp_dataconn {
   unsigned char type;
   unsigned char conntype;
@@ -57,7 +66,16 @@ struct ftp_dataconn {
   unsigned char filenameptr;
   char filename[MAX_FILENAMELEN];
 
-  
+  struct ftp_connection *c;
+
+  /* The local file of the current transfer, -1 when there is none. */
+  int fd;
+  /* Bytes sent in the segment that is not yet acknowledged. */
+  u16_t sendlen;
+  /* Set when the data connection or the final reply of the transfer
+     has been seen. The transfer is done when both have. */
+  unsigned char closed;
+  unsigned char replied;
 };
 
 struct ftp_connection {
@@ -92,8 +110,16 @@ struct ftp_connection {
 
 #define STATE_SEND_QUIT   19
 #define STATE_QUIT_SENT   20
+
+#define STATE_SEND_REST   21
+#define STATE_REST_SENT   22
+#define STATE_SEND_STOR   23
+#define STATE_STOR_SENT   24
   
   unsigned char connected_confirmed;
+
+  struct ftp_connection *next;
+  struct ftpc_transfer *transfers;
   
   struct ftp_dataconn dataconn;
   
@@ -115,18 +141,129 @@ static const struct {
   {"TYPE I\r\n"}
 };
 
-static struct ftp_connection *waiting_for_dataconn;
+static struct ftp_connection *conns;
+static u16_t dataport = DATAPORT;
 
-MEMB(connections, struct ftp_connection, 1);
+MEMB(connections, struct ftp_connection, FTPC_MAX_CONNECTIONS);
 
 /*---------------------------------------------------------------------------*/
 void
 ftpc_init(void)
 {
   memb_init(&connections);
+  conns = NULL;
   /*  tcp_listen(UIP_HTONS(DATAPORT));*/
 }
 /*---------------------------------------------------------------------------*/
+/* Each connection listens on its own data port, and takes a new one
+   for every transfer so that the server does not connect to a port
+   that is still in TIME-WAIT. */
+static void
+new_dataport(struct ftp_connection *c)
+{
+  if(c->dataconn.port != 0) {
+    tcp_unlisten(uip_htons(c->dataconn.port));
+  }
+  c->dataconn.port = dataport;
+  if(++dataport == 0) {
+    dataport = DATAPORT;
+  }
+  tcp_listen(uip_htons(c->dataconn.port));
+}
+/*---------------------------------------------------------------------------*/
+/* Opens the local file of the first queued transfer and issues its
+   command, unless a transfer is already running. Transfers whose
+   local file cannot be opened are completed at once with status
+   FTPC_NOFILE. */
+static void
+next_transfer(struct ftp_connection *c)
+{
+  struct ftp_dataconn *d = &c->dataconn;
+  struct ftpc_transfer *t;
+  int fd;
+
+  while(c->state == STATE_CONNECTED && d->fd < 0 &&
+	(t = c->transfers) != NULL) {
+    if(t->dir == FTPC_STOR) {
+      fd = cfs_open(t->localname, CFS_READ);
+    } else if(t->offset > 0) {
+      fd = cfs_open(t->localname, CFS_WRITE | CFS_APPEND);
+    } else {
+      fd = cfs_open(t->localname, CFS_WRITE);
+    }
+    if(fd < 0) {
+      c->transfers = t->next;
+      t->status = FTPC_NOFILE;
+      ftpc_transfer_done(t);
+      continue;
+    }
+    cfs_seek(fd, t->offset, CFS_SEEK_SET);
+
+    d->fd = fd;
+    d->conntype = CONNTYPE_FILE;
+    d->sendlen = 0;
+    d->closed = 0;
+    d->replied = 0;
+    if(t->offset > 0) {
+      c->state = STATE_SEND_REST;
+    } else if(t->dir == FTPC_STOR) {
+      c->state = STATE_SEND_STOR;
+    } else {
+      c->state = STATE_SEND_RETR;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+finish_transfer(struct ftp_connection *c)
+{
+  struct ftpc_transfer *t;
+
+  t = c->transfers;
+  c->transfers = t->next;
+  cfs_close(c->dataconn.fd);
+  c->dataconn.fd = -1;
+  ftpc_transfer_done(t);
+
+  next_transfer(c);
+}
+/*---------------------------------------------------------------------------*/
+/* Finishes a transfer that has used the data port, once both its data
+   connection has closed and its reply has arrived. The next transfer
+   gets a new port. */
+static void
+end_transfer(struct ftp_connection *c)
+{
+  new_dataport(c);
+  c->state = STATE_SEND_PORT;
+  finish_transfer(c);
+}
+/*---------------------------------------------------------------------------*/
+/* Drops the transfers of a connection that has gone away. They keep
+   their offset, so they can be queued again on a new connection to
+   resume where they stopped. */
+static void
+remove_connection(struct ftp_connection *c)
+{
+  struct ftp_connection **cp;
+
+  c->dataconn.type = TYPE_ABORT;
+  if(c->dataconn.fd >= 0) {
+    cfs_close(c->dataconn.fd);
+    c->dataconn.fd = -1;
+  }
+  c->transfers = NULL;
+  tcp_unlisten(uip_htons(c->dataconn.port));
+
+  for(cp = &conns; *cp != NULL; cp = &(*cp)->next) {
+    if(*cp == c) {
+      *cp = c->next;
+      break;
+    }
+  }
+  memb_free(&connections, c);
+}
+/*---------------------------------------------------------------------------*/
 void *
 ftpc_connect(uip_ipaddr_t *ipaddr, u16_t port)
 {
@@ -140,14 +277,20 @@ ftpc_connect(uip_ipaddr_t *ipaddr, u16_t port)
   c->state = STATE_INITIAL;
   c->connected_confirmed = 0;
   c->codeptr = 0;
+  c->transfers = NULL;
   c->dataconn.type = TYPE_DATA;
-  c->dataconn.port = DATAPORT;
-  tcp_listen(UIP_HTONS(DATAPORT));
+  c->dataconn.c = c;
+  c->dataconn.fd = -1;
+  c->dataconn.port = 0;
+  new_dataport(c);
 
   if(tcp_connect(ipaddr, port, c) == NULL) {
+    tcp_unlisten(uip_htons(c->dataconn.port));
     memb_free(&connections, c);
     return NULL;
   }
+  c->next = conns;
+  conns = c;
 
   return c;
 }
@@ -181,6 +324,29 @@ handle_input(struct ftp_connection *c)
       ftpc_connected(c);
       c->connected_confirmed = 1;
     }
+    next_transfer(c);
+  } else if(c->state == STATE_REST_SENT) {
+    if(code == 350) {
+      c->state = c->transfers->dir == FTPC_STOR?
+	STATE_SEND_STOR: STATE_SEND_RETR;
+    } else {
+      /* No data connection was opened, so the port can be kept. */
+      c->transfers->status = code;
+      c->state = STATE_CONNECTED;
+      finish_transfer(c);
+    }
+  } else if(c->state == STATE_RETR_SENT ||
+	    c->state == STATE_STOR_SENT) {
+    if(code >= 200) {
+      c->transfers->status = code;
+      if(code >= 300 || c->dataconn.closed) {
+	end_transfer(c);
+      } else {
+	/* The data connection keeps its port until it has closed, as
+	   its last segments may still arrive after this reply. */
+	c->dataconn.replied = 1;
+      }
+    }
   } else if(c->state == STATE_OPTION_SENT) {
     if(c->optionsptr >= options.num) {
       c->state = STATE_SEND_PORT;
@@ -188,12 +354,9 @@ handle_input(struct ftp_connection *c)
       c->state = STATE_SEND_OPTIONS;
     }
   } else if((c->state == STATE_NLST_SENT ||
-	     c->state == STATE_RETR_SENT ||
 	     c->state == STATE_CONNECTED)) {
     if(code == 226 || code == 550) {
-      tcp_unlisten(uip_htons(c->dataconn.port));
-      ++c->dataconn.port;
-      tcp_listen(uip_htons(c->dataconn.port));
+      new_dataport(c);
       c->state = STATE_SEND_PORT;
     }
 
@@ -252,6 +415,12 @@ acked(struct ftp_connection *c)
   case STATE_SEND_RETR:
     c->state = STATE_RETR_SENT;
     break;
+  case STATE_SEND_REST:
+    c->state = STATE_REST_SENT;
+    break;
+  case STATE_SEND_STOR:
+    c->state = STATE_STOR_SENT;
+    break;
   case STATE_SEND_CWD:
     c->state = STATE_CWD_SENT;
     break;
@@ -298,7 +467,14 @@ senddata(struct ftp_connection *c)
     strcpy(uip_appdata, "NLST\r\n");
     break;
   case STATE_SEND_RETR:
-    len = sprintf(uip_appdata, "RETR %s\r\n", c->filename);
+    len = sprintf(uip_appdata, "RETR %s\r\n", c->transfers->remotename);
+    break;
+  case STATE_SEND_REST:
+    len = sprintf(uip_appdata, "REST %lu\r\n",
+		  (unsigned long)c->transfers->offset);
+    break;
+  case STATE_SEND_STOR:
+    len = sprintf(uip_appdata, "STOR %s\r\n", c->transfers->remotename);
     break;
   case STATE_SEND_CWD:
     len = sprintf(uip_appdata, "CWD %s\r\n", c->filename);
@@ -319,6 +495,69 @@ senddata(struct ftp_connection *c)
   uip_send(uip_appdata, len);
 }
 /*---------------------------------------------------------------------------*/
+static void
+data_closed(struct ftp_dataconn *d)
+{
+  if(d->fd < 0 || d->closed) {
+    return;
+  }
+  if(d->replied) {
+    end_transfer(d->c);
+  } else {
+    d->closed = 1;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Moves file data between the data connection and CFS. Received
+   segments are written to the file as they are, and segments to send
+   are read from the file straight into the uIP buffer. A
+   retransmission reads the same bytes again from the file. */
+static void
+filedata(struct ftp_dataconn *d)
+{
+  struct ftpc_transfer *t;
+  int len;
+
+  if(d->fd < 0) {
+    uip_abort();
+    return;
+  }
+  t = d->c->transfers;
+
+  if(t->dir == FTPC_RETR) {
+    if(uip_newdata()) {
+      len = cfs_write(d->fd, uip_appdata, uip_datalen());
+      if(len != uip_datalen()) {
+	uip_abort();
+	return;
+      }
+      t->offset += len;
+    }
+  } else {
+    if(uip_acked()) {
+      t->offset += d->sendlen;
+      d->sendlen = 0;
+    }
+    if(uip_rexmit() ||
+       (d->sendlen == 0 &&
+	(uip_connected() || uip_acked() || uip_poll()))) {
+      cfs_seek(d->fd, t->offset, CFS_SEEK_SET);
+      len = cfs_read(d->fd, uip_appdata,
+		     uip_rexmit()? d->sendlen: uip_mss());
+      if(len > 0) {
+	d->sendlen = len;
+	uip_send(uip_appdata, len);
+      } else if(!uip_rexmit()) {
+	uip_close();
+      }
+    }
+  }
+
+  if(uip_closed() || uip_aborted() || uip_timedout()) {
+    data_closed(d);
+  }
+}
+/*---------------------------------------------------------------------------*/
 void
 ftpc_appcall(void *state)
 {
@@ -328,12 +567,20 @@ ftpc_appcall(void *state)
     
   if(uip_connected()) {
     if(state == NULL) {
-      if(waiting_for_dataconn != NULL) {
-	d = &waiting_for_dataconn->dataconn;
-	waiting_for_dataconn = NULL;
+      /* The server connects back to the data port of the connection
+	 that asked for the transfer. */
+      for(c = conns; c != NULL; c = c->next) {
+	if(uip_conn->lport == uip_htons(c->dataconn.port)) {
+	  break;
+	}
+      }
+      if(c != NULL) {
+	d = &c->dataconn;
 	tcp_markconn(uip_conn, d);
 	d->filenameptr = 0;
-	
+	if(d->conntype == CONNTYPE_FILE) {
+	  filedata(d);
+	}
       } else {
 	uip_abort();
       }
@@ -357,19 +604,16 @@ ftpc_appcall(void *state)
 
   if(c->type == TYPE_CONTROL) {
     if(uip_closed()) {
-      c->dataconn.type = TYPE_ABORT;
+      remove_connection(c);
       ftpc_closed();
-      memb_free(&connections, c);
     }
     if(uip_aborted()) {
-      c->dataconn.type = TYPE_ABORT;
+      remove_connection(c);
       ftpc_aborted();
-      memb_free(&connections, c);
     }
     if(uip_timedout()) {
-      c->dataconn.type = TYPE_ABORT;
+      remove_connection(c);
       ftpc_timedout();
-      memb_free(&connections, c);
     }
 
 
@@ -411,14 +655,11 @@ ftpc_appcall(void *state)
       if(uip_closed()) {
 	ftpc_list_file(NULL);
       }
+    } else if(uip_conn->lport != uip_htons(d->port)) {
+      /* Left over from an earlier transfer. */
+      uip_abort();
     } else {
-      if(uip_newdata()) {
-	ftpc_data(uip_appdata, uip_datalen());
-	/*	printf("Received %d data bytes: '%s'\n",
-		uip_datalen(), uip_appdata);*/
-      } else if(uip_closed() || uip_timedout() || uip_aborted()) {
-	ftpc_data(NULL, 0);
-      }
+      filedata(d);
     }
   }
 }
@@ -431,34 +672,39 @@ ftpc_list(void *conn)
   c = conn;
   
   if(c == NULL ||
-     c->state != STATE_CONNECTED) {
+     c->state != STATE_CONNECTED ||
+     c->dataconn.fd >= 0) {
     return 0;
   }
 
   c->state = STATE_SEND_NLST;
   c->dataconn.conntype = CONNTYPE_LIST;
-  waiting_for_dataconn = c;
   return 1;
 }
 /*---------------------------------------------------------------------------*/
 char
-ftpc_get(void *conn, char *filename)
+ftpc_transfer(void *conn, struct ftpc_transfer *t)
 {
   struct ftp_connection *c;
+  struct ftpc_transfer **tp;
 
   c = conn;
-  
-  if(c == NULL ||
-     c->state != STATE_CONNECTED) {
+
+  if(c == NULL) {
     return 0;
   }
 
-  strncpy(c->filename, filename, sizeof(c->filename));
-  petsciiconv_toascii(c->filename, sizeof(c->filename));
+  for(tp = &c->transfers; *tp != NULL; tp = &(*tp)->next) {
+    if(*tp == t) {
+      /* Already queued or running. */
+      return 0;
+    }
+  }
+  t->next = NULL;
+  t->status = 0;
+  *tp = t;
 
-  c->state = STATE_SEND_RETR;
-  c->dataconn.conntype = CONNTYPE_FILE;
-  waiting_for_dataconn = c;
+  next_transfer(c);
   return 1;
 }
 /*---------------------------------------------------------------------------*/
@@ -36,6 +36,21 @@
 #define __FTPC_H__
 
 #include "contiki-net.h"
+#include "cfs/cfs.h"
+
+/* A file to copy between CFS and the server. The offset is advanced
+   as data is moved, so a transfer that was cut short can be queued
+   again to resume where it stopped, using REST. */
+struct ftpc_transfer {
+  struct ftpc_transfer *next;
+  char *localname;
+  char *remotename;
+  unsigned char dir;
+#define FTPC_RETR 0
+#define FTPC_STOR 1
+  cfs_offset_t offset;
+  unsigned short status;
+};
 
 void ftpc_init(void);
 
@@ -43,13 +58,19 @@ void *ftpc_connect(uip_ipaddr_t *ipaddr, u16_t port);
 char ftpc_list(void *connection);
 void ftpc_cwd(void *connection, char *dir);
 void ftpc_cdup(void *connection);
-char ftpc_get(void *connection, char *filename);
+/* Queues a transfer. The transfers of a connection are done one at a
+   time, and ftpc_transfer_done() is called for each with status set
+   to the final reply of the server, or to FTPC_NOFILE. Several
+   connections run their transfers in parallel. */
+char ftpc_transfer(void *connection, struct ftpc_transfer *t);
 void ftpc_close(void *connection);
 
 
 void ftpc_appcall(void *state);
 
+#define FTPC_NOFILE    1
 #define FTPC_OK        200
+#define FTPC_DONE      226
 #define FTPC_COMPLETED 250
 #define FTPC_NODIR     431
 #define FTPC_NOTDIR    550
@@ -63,6 +84,6 @@ void ftpc_closed(void);
 void ftpc_aborted(void);
 void ftpc_timedout(void);
 void ftpc_list_file(char *filename);
-void ftpc_data(u8_t *data, u16_t len);
+void ftpc_transfer_done(struct ftpc_transfer *t);
 
 #endif /* __FTPC_H__ */
@@ -54,7 +54,7 @@ void init_packet(coap_packet_t* packet)
   packet->payload_len = 0;
 }
 
-int serialize_packet(coap_packet_t* packet, uint8_t* buffer)
+int serialize_header(coap_packet_t* packet, uint8_t* buffer)
 {
   int index = 0;
   header_option_t* option = NULL;
@@ -104,6 +104,13 @@ int serialize_packet(coap_packet_t* packet, uint8_t* buffer)
     option_delta += option->option;
   }
 
+  return index;
+}
+
+int serialize_packet(coap_packet_t* packet, uint8_t* buffer)
+{
+  int index = serialize_header(packet, buffer);
+
   if(packet->payload){
     memcpy(&buffer[index], packet->payload, packet->payload_len);
     index += packet->payload_len;
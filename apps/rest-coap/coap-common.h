@@ -139,6 +139,8 @@ typedef enum
 } error_t;
 
 int serialize_packet(coap_packet_t* request, uint8_t* buffer);
+/*Serializes the header and options only, the payload is left at packet->payload*/
+int serialize_header(coap_packet_t* packet, uint8_t* buffer);
 void init_packet(coap_packet_t* packet);
 
 #endif /* COAP_COMMON_H_ */
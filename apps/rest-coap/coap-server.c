@@ -243,6 +243,8 @@ fill_error_packet(coap_packet_t* packet, int error, uint16_t tid)
   packet->option_count=0;
   packet->url=NULL;
   packet->options=NULL;
+  packet->payload=NULL;
+  packet->payload_len=0;
   switch (error){
     case MEMORY_ALLOC_ERR:
       packet->code=INTERNAL_SERVER_ERROR_500;
@@ -397,13 +399,23 @@ coap_set_method(coap_packet_t* packet, coap_method_t method)
   packet->code = (uint8_t)method;
 }
 
-static void send_request(coap_packet_t* request, struct uip_udp_conn *client_conn)
+/*Header and options are serialized in buf, the payload is sent from where it is*/
+static void send_packet(coap_packet_t* packet, struct uip_udp_conn *conn)
 {
   char buf[MAX_PAYLOAD_LEN];
-  int data_size = 0;
+  struct uip_udp_iovec iov[2];
+
+  iov[0].data = buf;
+  iov[0].len = serialize_header(packet, buf);
+  iov[1].data = packet->payload;
+  iov[1].len = packet->payload ? packet->payload_len : 0;
 
-  data_size = serialize_packet(request, buf);
+  PRINTF("Sending message size: %d\n", iov[0].len + iov[1].len);
+  uip_udp_packet_sendv(conn, iov, 2);
+}
 
+static void send_request(coap_packet_t* request, struct uip_udp_conn *client_conn)
+{
   PRINTF("Created a connection with the server ");
   PRINT6ADDR(&client_conn->ripaddr);
   PRINTF(" local/remote port %u/%u\n",
@@ -411,28 +423,30 @@ static void send_request(coap_packet_t* request, struct uip_udp_conn *client_con
 
   PRINTF("Sending to: ");
   PRINT6ADDR(&client_conn->ripaddr);
-  uip_udp_packet_send(client_conn, buf, data_size);
+  send_packet(request, client_conn);
 }
 
 static int
 handle_incoming_data(void)
 {
   int error=NO_ERROR;
-  char buf[MAX_PAYLOAD_LEN];
 
   PRINTF("uip_datalen received %u \n",(u16_t)uip_datalen());
 
   char* data = uip_appdata + uip_ext_len;
   u16_t datalen = uip_datalen() - uip_ext_len;
 
-  int data_size = 0;
-
   if (uip_newdata()) {
     ((char *)data)[datalen] = 0;
     PRINTF("Server received: '%s' (port:%u) from ", (char *)data, uip_htons(UIP_UDP_BUF->srcport));
     PRINT6ADDR(&UIP_IP_BUF->srcipaddr);
     PRINTF("\n");
 
+    /*The response is sent while the request still is in the buffers, so
+      uip_buf must not be needed after this point*/
+    uip_ipaddr_copy(&server_conn->ripaddr, &UIP_IP_BUF->srcipaddr);
+    server_conn->rport = UIP_UDP_BUF->srcport;
+
     if (init_buffer(COAP_DATA_BUFF_SIZE)) {
       coap_packet_t* request = (coap_packet_t*)allocate_buffer(sizeof(coap_packet_t));
       parse_message(request, (uint8_t*)data, datalen);
@@ -447,8 +461,7 @@ handle_incoming_data(void)
           service_cbk(request, response);
         }
 
-        data_size = serialize_packet(response, buf);
-
+        send_packet(response, server_conn);
       }
       delete_buffer();
     } else {
@@ -457,14 +470,9 @@ handle_incoming_data(void)
       /*FIXME : Crappy way of accessing TID of the incoming packet, fix it!*/
       coap_packet_t error_packet;
       fill_error_packet(&error_packet,error, (data[2] << 8) + data[3]);
-      data_size = serialize_packet(&error_packet, buf);
+      send_packet(&error_packet, server_conn);
     }
 
-    uip_ipaddr_copy(&server_conn->ripaddr, &UIP_IP_BUF->srcipaddr);
-    server_conn->rport = UIP_UDP_BUF->srcport;
-
-    PRINTF("Responding with message size: %d\n",data_size);
-    uip_udp_packet_send(server_conn, buf, data_size);
     /* Restore server connection to allow data from any node */
     memset(&server_conn->ripaddr, 0, sizeof(server_conn->ripaddr));
     server_conn->rport = 0;
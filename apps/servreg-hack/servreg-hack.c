@@ -52,31 +52,89 @@
 #include "servreg-hack.h"
 
 #include <stdio.h>
+#include <string.h>
 
 struct servreg_hack_registration {
   struct servreg_hack_registration *next;
+  struct servreg_hack_registration *hash_next;
 
   struct timer timer;
   uip_ipaddr_t addr;
   servreg_hack_id_t id;
   uint8_t seqno;
+  uint8_t changed;
 };
 
 
+#ifdef SERVREG_HACK_CONF_MAX_REGISTRATIONS
+#define MAX_REGISTRATIONS SERVREG_HACK_CONF_MAX_REGISTRATIONS
+#else /* SERVREG_HACK_CONF_MAX_REGISTRATIONS */
 #define MAX_REGISTRATIONS 16
+#endif /* SERVREG_HACK_CONF_MAX_REGISTRATIONS */
+
+/* Number of hash buckets used for looking up services registered by
+   others. Must be a power of two. */
+#ifdef SERVREG_HACK_CONF_HASH_SIZE
+#define HASH_SIZE SERVREG_HACK_CONF_HASH_SIZE
+#else /* SERVREG_HACK_CONF_HASH_SIZE */
+#define HASH_SIZE 8
+#endif /* SERVREG_HACK_CONF_HASH_SIZE */
+
+#if (HASH_SIZE & (HASH_SIZE - 1)) != 0
+#error SERVREG_HACK_CONF_HASH_SIZE must be a power of two
+#endif
+
+#define HASH(id) ((id) & (HASH_SIZE - 1))
 
 LIST(others_services);
 LIST(own_services);
 
 MEMB(registrations, struct servreg_hack_registration, MAX_REGISTRATIONS);
 
+static struct servreg_hack_registration *hash_table[HASH_SIZE];
+
 PROCESS(servreg_hack_process, "Service regstry hack");
 
-#define PERIOD_TIME 120 * CLOCK_SECOND
+/* Registrations are disseminated with a Trickle timer: the interval
+   starts at IMIN and doubles up to IMAX as long as the neighbors
+   announce the same registrations as we have. A node only announces
+   in an interval if it has heard fewer than REDUNDANCY consistent
+   announcements in it. Any new or updated registration resets the
+   interval to IMIN. */
+#ifdef SERVREG_HACK_CONF_IMIN
+#define IMIN SERVREG_HACK_CONF_IMIN
+#else /* SERVREG_HACK_CONF_IMIN */
+#define IMIN 4 * CLOCK_SECOND
+#endif /* SERVREG_HACK_CONF_IMIN */
+
+#ifdef SERVREG_HACK_CONF_IMAX
+#define IMAX SERVREG_HACK_CONF_IMAX
+#else /* SERVREG_HACK_CONF_IMAX */
+#define IMAX PERIOD_TIME
+#endif /* SERVREG_HACK_CONF_IMAX */
+
+#ifdef SERVREG_HACK_CONF_REDUNDANCY
+#define REDUNDANCY SERVREG_HACK_CONF_REDUNDANCY
+#else /* SERVREG_HACK_CONF_REDUNDANCY */
+#define REDUNDANCY 2
+#endif /* SERVREG_HACK_CONF_REDUNDANCY */
+
+/* The maximum number of pages (UDP packets) sent in one
+   announcement. Registrations that do not fit are sent in the
+   following intervals. */
+#ifdef SERVREG_HACK_CONF_MAX_PAGES
+#define MAX_PAGES SERVREG_HACK_CONF_MAX_PAGES
+#else /* SERVREG_HACK_CONF_MAX_PAGES */
+#define MAX_PAGES 2
+#endif /* SERVREG_HACK_CONF_MAX_PAGES */
 
-#define NEW_REG_TIME 10 * CLOCK_SECOND
+#define PERIOD_TIME 120 * CLOCK_SECOND
 
+#ifdef SERVREG_HACK_CONF_MAX_BUFSIZE
+#define MAX_BUFSIZE SERVREG_HACK_CONF_MAX_BUFSIZE
+#else /* SERVREG_HACK_CONF_MAX_BUFSIZE */
 #define MAX_BUFSIZE 2 + 80
+#endif /* SERVREG_HACK_CONF_MAX_BUFSIZE */
 
 #define UDP_PORT 61616
 
@@ -84,32 +142,64 @@ PROCESS(servreg_hack_process, "Service regstry hack");
 
 #define SEQNO_LT(a, b) ((signed char)((a) - (b)) < 0)
 
-static struct etimer sendtimer;
+static struct etimer sendtimer, intervaltimer;
+static clock_time_t interval;
+static uint8_t counter;
+
+/* Index of the registration that the next full page starts with */
+static uint8_t page_start;
+
+static void reset_trickle(void);
 
+/*---------------------------------------------------------------------------*/
+static void
+hash_remove(struct servreg_hack_registration *r)
+{
+  struct servreg_hack_registration **p;
+
+  for(p = &hash_table[HASH(r->id)]; *p != NULL; p = &(*p)->hash_next) {
+    if(*p == r) {
+      *p = r->hash_next;
+      return;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+hash_push(struct servreg_hack_registration *r)
+{
+  r->hash_next = hash_table[HASH(r->id)];
+  hash_table[HASH(r->id)] = r;
+}
 /*---------------------------------------------------------------------------*/
 /* Go through the list of registrations and remove those that are too
    old. */
 static void
 purge_registrations(void)
 {
-  struct servreg_hack_registration *t;
+  struct servreg_hack_registration *t, *next;
 
   for(t = list_head(own_services);
       t != NULL;
       t = list_item_next(t)) {
     if(timer_expired(&t->timer)) {
       t->seqno++;
+      t->changed = 1;
       timer_set(&t->timer, LIFETIME / 2);
+      PROCESS_CONTEXT_BEGIN(&servreg_hack_process);
+      reset_trickle();
+      PROCESS_CONTEXT_END(&servreg_hack_process);
     }
   }
 
   for(t = list_head(others_services);
       t != NULL;
-      t = list_item_next(t)) {
+      t = next) {
+    next = list_item_next(t);
     if(timer_expired(&t->timer)) {
+      hash_remove(t);
       list_remove(others_services, t);
       memb_free(&registrations, t);
-      t = list_head(others_services);
     }
   }
 }
@@ -120,6 +210,7 @@ servreg_hack_init(void)
   list_init(others_services);
   list_init(own_services);
   memb_init(&registrations);
+  memset(hash_table, 0, sizeof(hash_table));
 
   process_start(&servreg_hack_process, NULL);
 }
@@ -149,12 +240,13 @@ servreg_hack_register(servreg_hack_id_t id)
   }
   r->id = id;
   r->seqno = 1;
+  r->changed = 1;
   timer_set(&r->timer, LIFETIME / 2);
   list_push(own_services, r);
 
 
   PROCESS_CONTEXT_BEGIN(&servreg_hack_process);
-  etimer_set(&sendtimer, random_rand() % (NEW_REG_TIME));
+  reset_trickle();
   PROCESS_CONTEXT_END(&servreg_hack_process);
 
 }
@@ -181,30 +273,33 @@ servreg_hack_item_address(servreg_hack_item_t *item)
 uip_ipaddr_t *
 servreg_hack_lookup(servreg_hack_id_t id)
 {
-  servreg_hack_item_t *t;
+  struct servreg_hack_registration *r;
 
   purge_registrations();
 
-  for(t = servreg_hack_list_head(); t != NULL; t = list_item_next(t)) {
-    if(servreg_hack_item_id(t) == id) {
-      return servreg_hack_item_address(t);
+  /* The most recently announced registration is first in its
+     bucket. */
+  for(r = hash_table[HASH(id)]; r != NULL; r = r->hash_next) {
+    if(r->id == id) {
+      return &r->addr;
     }
   }
   return NULL;
 }
 /*---------------------------------------------------------------------------*/
-static void
+/* Returns non-zero if the incoming registration was inconsistent with
+   what we have, i.e., if either side had newer information. */
+static int
 handle_incoming_reg(const uip_ipaddr_t *owner, servreg_hack_id_t id, uint8_t seqno)
 {
-  servreg_hack_item_t *t;
   struct servreg_hack_registration *r;
 
-  /* Walk through list, see if we already have a service ID
-     registered. If so, we do different things depending on the seqno
-     of the update: if the seqno is older than what we have, we
-     discard the incoming registration. If the seqno is newer than
-     what we have, we reset the lifetime timer of the current
-     registration.
+  /* Look the registration up in the hash table, see if we already
+     have the service registered by this owner. If so, we do different
+     things depending on the seqno of the update: if the seqno is
+     older than what we have, we mark our registration as changed so
+     that we send it out again. If the seqno is newer than what we
+     have, we reset the lifetime timer of the current registration.
 
      If we did not have the service registered already, we allocate a
      new registration and put it on our list. If we cannot allocate a
@@ -213,35 +308,62 @@ handle_incoming_reg(const uip_ipaddr_t *owner, servreg_hack_id_t id, uint8_t seq
      that we have). */
 
   /*  printf("Handle incoming reg id %d seqno %d\n", id, seqno);*/
-  
-  for(t = servreg_hack_list_head();
-      t != NULL;
-      t = list_item_next(t)) {
-    if(servreg_hack_item_id(t) == id) {
-      r = t;
+
+  if(uip_ds6_is_my_addr((uip_ipaddr_t *)owner)) {
+    for(r = list_head(own_services); r != NULL; r = list_item_next(r)) {
+      if(r->id == id) {
+        if(SEQNO_LT(seqno, r->seqno)) {
+          r->changed = 1;
+          return 1;
+        } else if(SEQNO_LT(r->seqno, seqno)) {
+          /* Our neighbors have a newer seqno for our own service than
+             we do, which happens when we have rebooted. Jump past it
+             so that our registration replaces theirs. */
+          r->seqno = seqno + 1;
+          r->changed = 1;
+          return 1;
+        }
+        return 0;
+      }
+    }
+    return 0;
+  }
+
+  for(r = hash_table[HASH(id)]; r != NULL; r = r->hash_next) {
+    if(r->id == id && uip_ipaddr_cmp(&r->addr, owner)) {
       if(SEQNO_LT(r->seqno, seqno)) {
         r->seqno = seqno;
+        r->changed = 1;
         timer_set(&r->timer, LIFETIME);
 
-        /* Put item first on list, so that subsequent lookups will
-           find this one. */
+        /* Put item first in its bucket and on the list, so that
+           subsequent lookups will find this one. */
+        hash_remove(r);
+        hash_push(r);
         list_remove(others_services, r);
         list_push(others_services, r);
+        return 1;
+      } else if(SEQNO_LT(seqno, r->seqno)) {
+        r->changed = 1;
+        return 1;
       }
-      return;
+      return 0;
     }
   }
 
   r = memb_alloc(&registrations);
   if(r == NULL) {
     printf("servreg_hack_register: error, could not allocate memory, should reclaim another registration but this has not been implemented yet.\n");
-    return;
+    return 0;
   }
   r->id = id;
-  r->seqno = 1;
+  r->seqno = seqno;
+  r->changed = 1;
   uip_ipaddr_copy(&r->addr, owner);
   timer_set(&r->timer, LIFETIME);
   list_add(others_services, r);
+  hash_push(r);
+  return 1;
 }
 /*---------------------------------------------------------------------------*/
 /*
@@ -256,6 +378,12 @@ handle_incoming_reg(const uip_ipaddr_t *owner, servreg_hack_id_t id, uint8_t seq
  *  +-------------------+-------------------+-------------------+
  *  |        ...        |       ...         |       ...         |
  *  +-------------------+-------------------+-------------------+
+ *
+ * A message is one page of an announcement. A delta page only
+ * carries registrations that have changed since they were last
+ * sent. A full page carries the next part of the complete table, and
+ * has the last page flag set if the table ends in it. Receivers
+ * handle all pages in the same way.
  */
 
 #define MSG_NUMREGS_OFFSET   0
@@ -268,63 +396,98 @@ handle_incoming_reg(const uip_ipaddr_t *owner, servreg_hack_id_t id, uint8_t seq
 
 #define MSG_ADDRS_LEN        20
 
+#define MSG_FLAG_DELTA       0x01
+#define MSG_FLAG_LAST_PAGE   0x02
+
 /*---------------------------------------------------------------------------*/
-static void
-send_udp_packet(struct uip_udp_conn *conn)
+static int
+add_reg(uint8_t *buf, int bufptr, const uip_ipaddr_t *addr,
+        struct servreg_hack_registration *r)
+{
+  uip_ipaddr_copy((uip_ipaddr_t *)&buf[bufptr + MSG_IPADDR_SUBOFFSET],
+                  addr);
+  buf[bufptr + MSG_REGS_SUBOFFSET] = r->id;
+  buf[bufptr + MSG_REGS_SUBOFFSET + 1] =
+    buf[bufptr + MSG_REGS_SUBOFFSET + 2] = 0;
+  buf[bufptr + MSG_SEQNO_SUBOFFSET] = r->seqno;
+  r->changed = 0;
+  return bufptr + MSG_ADDRS_LEN;
+}
+/*---------------------------------------------------------------------------*/
+/* Send one page of registrations. With delta set, only changed
+   registrations are sent, otherwise the page starts with registration
+   number page_start in the table. Returns the number of registrations
+   sent. */
+static int
+send_page(struct uip_udp_conn *conn, const uip_ipaddr_t *own, int delta)
 {
-  int numregs;
   uint8_t buf[MAX_BUFSIZE];
   int bufptr;
-  servreg_hack_item_t *t;
-  uip_ds6_addr_t *addr;
-  
-  addr = uip_ds6_get_global(-1);
-  
-  buf[MSG_FLAGS_OFFSET]   = 0;
+  int numregs;
+  int index;
+  struct servreg_hack_registration *t;
+  list_t l;
 
   numregs = 0;
+  index = 0;
   bufptr = MSG_ADDRS_OFFSET;
-
-
-  if(addr != NULL) {
-    for(t = list_head(own_services);
-        (bufptr + MSG_ADDRS_LEN <= MAX_BUFSIZE) && t != NULL;
-        t = list_item_next(t)) {
-      
-      uip_ipaddr_copy((uip_ipaddr_t *)&buf[bufptr + MSG_IPADDR_SUBOFFSET],
-                      &addr->ipaddr);
-      buf[bufptr + MSG_REGS_SUBOFFSET] =
-        servreg_hack_item_id(t);
-      buf[bufptr + MSG_REGS_SUBOFFSET + 1] =
-        buf[bufptr + MSG_REGS_SUBOFFSET + 2] = 0;
-      buf[bufptr + MSG_SEQNO_SUBOFFSET] = ((struct servreg_hack_registration *)t)->seqno;
-      
-      bufptr += MSG_ADDRS_LEN;
+  buf[MSG_FLAGS_OFFSET] = delta ? MSG_FLAG_DELTA : MSG_FLAG_LAST_PAGE;
+
+  for(l = own != NULL ? own_services : others_services;
+      l != NULL;
+      l = l == own_services ? others_services : NULL) {
+    for(t = list_head(l); t != NULL; t = list_item_next(t), index++) {
+      if((delta && !t->changed) || (!delta && index < page_start)) {
+        continue;
+      }
+      if(bufptr + MSG_ADDRS_LEN > MAX_BUFSIZE) {
+        /* The rest goes on the next page. */
+        buf[MSG_FLAGS_OFFSET] &= ~MSG_FLAG_LAST_PAGE;
+        break;
+      }
+      bufptr = add_reg(buf, bufptr, l == own_services ? own : &t->addr, t);
       ++numregs;
     }
+    if(t != NULL) {
+      break;
+    }
   }
-  
-  for(t = servreg_hack_list_head();
-      (bufptr + MSG_ADDRS_LEN <= MAX_BUFSIZE) && t != NULL;
-      t = list_item_next(t)) {
-    uip_ipaddr_copy((uip_ipaddr_t *)&buf[bufptr + MSG_IPADDR_SUBOFFSET],
-                    servreg_hack_item_address(t));
-    buf[bufptr + MSG_REGS_SUBOFFSET] =
-      servreg_hack_item_id(t);
-    buf[bufptr + MSG_REGS_SUBOFFSET + 1] =
-      buf[bufptr + MSG_REGS_SUBOFFSET + 2] = 0;
-    buf[bufptr + MSG_SEQNO_SUBOFFSET] = ((struct servreg_hack_registration *)t)->seqno;
 
-    bufptr += MSG_ADDRS_LEN;
-    ++numregs;
+  if(!delta) {
+    page_start = (buf[MSG_FLAGS_OFFSET] & MSG_FLAG_LAST_PAGE) ?
+      0 : page_start + numregs;
   }
-  /*  printf("send_udp_packet numregs %d\n", numregs);*/
+
+  /*  printf("send_page numregs %d\n", numregs);*/
   buf[MSG_NUMREGS_OFFSET] = numregs;
 
   if(numregs > 0) {
     /*    printf("Sending buffer len %d\n", bufptr);*/
     uip_udp_packet_send(conn, buf, bufptr);
   }
+  return numregs;
+}
+/*---------------------------------------------------------------------------*/
+static void
+send_udp_packet(struct uip_udp_conn *conn)
+{
+  uip_ds6_addr_t *addr;
+  const uip_ipaddr_t *own;
+  int pages;
+
+  addr = uip_ds6_get_global(-1);
+  own = addr != NULL ? &addr->ipaddr : NULL;
+
+  /* Send what has changed. If nothing has, send the next page of the
+     full table so that new nodes eventually learn all of it. */
+  for(pages = 0; pages < MAX_PAGES; pages++) {
+    if(send_page(conn, own, 1) == 0) {
+      break;
+    }
+  }
+  if(pages == 0) {
+    send_page(conn, own, 0);
+  }
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -334,23 +497,57 @@ parse_incoming_packet(const u8_t *buf, int len)
   int flags;
   int i;
   int bufptr;
+  int inconsistent;
+
+  if(len < MSG_ADDRS_OFFSET) {
+    return;
+  }
 
   numregs = buf[MSG_NUMREGS_OFFSET];
   flags   = buf[MSG_FLAGS_OFFSET];
 
   /*  printf("Numregs %d flags %d\n", numregs, flags);*/
 
+  inconsistent = 0;
   bufptr = MSG_ADDRS_OFFSET;
-  for(i = 0; i < numregs; ++i) {
-    handle_incoming_reg((uip_ipaddr_t *)&buf[bufptr + MSG_IPADDR_SUBOFFSET],
-                        buf[bufptr + MSG_REGS_SUBOFFSET],
-                        buf[bufptr + MSG_SEQNO_SUBOFFSET]);
+  for(i = 0; i < numregs && bufptr + MSG_ADDRS_LEN <= len; ++i) {
+    inconsistent |=
+      handle_incoming_reg((uip_ipaddr_t *)&buf[bufptr + MSG_IPADDR_SUBOFFSET],
+                          buf[bufptr + MSG_REGS_SUBOFFSET],
+                          buf[bufptr + MSG_SEQNO_SUBOFFSET]);
+    bufptr += MSG_ADDRS_LEN;
+  }
+
+  if(inconsistent) {
+    reset_trickle();
+  } else {
+    counter++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+new_interval(void)
+{
+  clock_time_t t;
+
+  counter = 0;
+  t = interval / 2;
+  t += random_rand() % (interval - t);
+  etimer_set(&sendtimer, t);
+  etimer_set(&intervaltimer, interval);
+}
+/*---------------------------------------------------------------------------*/
+static void
+reset_trickle(void)
+{
+  if(interval != IMIN) {
+    interval = IMIN;
+    new_interval();
   }
 }
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(servreg_hack_process, ev, data)
 {
-  static struct etimer periodic;
   static struct uip_udp_conn *outconn, *inconn;
   PROCESS_BEGIN();
 
@@ -362,15 +559,22 @@ PROCESS_THREAD(servreg_hack_process, ev, data)
   inconn = udp_new(NULL, UIP_HTONS(UDP_PORT), NULL);
   udp_bind(inconn, UIP_HTONS(UDP_PORT));
 
-  etimer_set(&periodic, PERIOD_TIME);
-  etimer_set(&sendtimer, random_rand() % (PERIOD_TIME));
+  interval = IMIN;
+  new_interval();
   while(1) {
     PROCESS_WAIT_EVENT();
-    if(ev == PROCESS_EVENT_TIMER && data == &periodic) {
-      etimer_reset(&periodic);
-      etimer_set(&sendtimer, random_rand() % (PERIOD_TIME));
+    if(ev == PROCESS_EVENT_TIMER && data == &intervaltimer) {
+      if(interval < IMAX) {
+        interval = interval * 2 < IMAX ? interval * 2 : IMAX;
+      }
+      new_interval();
+      /* Purge after the new interval has started, so that a change
+         resets the timer to IMIN instead of being doubled. */
+      purge_registrations();
     } else if(ev == PROCESS_EVENT_TIMER && data == &sendtimer) {
-      send_udp_packet(outconn);
+      if(counter < REDUNDANCY) {
+        send_udp_packet(outconn);
+      }
     } else if(ev == tcpip_event) {
       parse_incoming_packet(uip_appdata, uip_datalen());
     }
@@ -52,7 +52,8 @@ SHELL_COMMAND(collect_view_data_command,
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(collect_view_data_process, ev, data)
 {
-  struct collect_view_data_msg msg;
+  uint8_t report[COLLECT_VIEW_REPORT_MAX_LEN];
+  int len;
   struct collect_neighbor *n;
   uint16_t parent_etx;
   uint16_t num_neighbors;
@@ -70,10 +71,11 @@ PROCESS_THREAD(collect_view_data_process, ev, data)
   num_neighbors = collect_neighbor_list_num(&shell_collect_conn.neighbor_list);
   beacon_interval = broadcast_announcement_beacon_interval() / CLOCK_SECOND;
 
-  collect_view_construct_message(&msg, &shell_collect_conn.parent,
-                                 parent_etx, shell_collect_conn.rtmetric,
-                                 num_neighbors, beacon_interval);
-  shell_output(&collect_view_data_command, &msg, sizeof(msg), "", 0);
+  len = collect_view_construct_report(report, sizeof(report),
+                                      &shell_collect_conn.parent,
+                                      parent_etx, shell_collect_conn.rtmetric,
+                                      num_neighbors, beacon_interval);
+  shell_output(&collect_view_data_command, report, len, "", 0);
 
   PROCESS_END();
 }
@@ -79,8 +79,10 @@ PROCESS_THREAD(shell_ls_process, ev, data)
 {
   static struct cfs_dir dir;
   static cfs_offset_t totsize;
-  struct cfs_dirent dirent;
+  static struct etimer etimer;
+  static struct cfs_dirent dirent;
   char buf[32];
+  PROCESS_EXITHANDLER(cfs_closedir(&dir));
   PROCESS_BEGIN();
   
   if(cfs_opendir(&dir, "/") != 0) {
@@ -88,6 +90,7 @@ PROCESS_THREAD(shell_ls_process, ev, data)
   } else {
     totsize = 0;
     while(cfs_readdir(&dir, &dirent) == 0) {
+      SHELL_OUTPUT_WAIT(&etimer);
       totsize += dirent.size;
       sprintf(buf, "%lu ", (unsigned long)dirent.size);
       /*      printf("'%s'\n", dirent.name);*/
@@ -192,6 +195,7 @@ PROCESS_THREAD(shell_read_process, ev, data)
   int len;
   int offset = 0;
   static int block_size = MAX_BLOCKSIZE;
+  static struct etimer etimer;
   PROCESS_EXITHANDLER(cfs_close(fd));
   PROCESS_BEGIN();
 
@@ -239,17 +243,23 @@ PROCESS_THREAD(shell_read_process, ev, data)
 	char buf[MAX_BLOCKSIZE];
 	int len;
 	struct shell_input *input;
+
+	if(shell_output_ready()) {
+	  len = cfs_read(fd, buf, block_size);
+	  if(len <= 0) {
+	    cfs_close(fd);
+	    PROCESS_EXIT();
+	  }
+	  shell_output(&read_command,
+		       buf, len, "", 0);
 	
-	len = cfs_read(fd, buf, block_size);
-	if(len <= 0) {
-	  cfs_close(fd);
-	  PROCESS_EXIT();
+	  process_post(&shell_read_process, PROCESS_EVENT_CONTINUE, NULL);
+	} else {
+	  /* Wait for the back-end to send what it has. */
+	  etimer_set(&etimer, CLOCK_SECOND / 16);
 	}
-	shell_output(&read_command,
-		     buf, len, "", 0);
-	
-	process_post(&shell_read_process, PROCESS_EVENT_CONTINUE, NULL);
 	PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_CONTINUE ||
+				 ev == PROCESS_EVENT_TIMER ||
 				 ev == shell_event_input);
 	
 	if(ev == shell_event_input) {
@@ -53,11 +53,21 @@ SHELL_COMMAND(ps_command,
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(shell_ps_process, ev, data)
 {
+  static struct etimer etimer;
+  static int n;
   struct process *p;
+  int i;
   PROCESS_BEGIN();
 
   shell_output_str(&ps_command, "Processes:", "");
-  for(p = PROCESS_LIST(); p != NULL; p = p->next) {
+  for(n = 0;; ++n) {
+    SHELL_OUTPUT_WAIT(&etimer);
+    /* Processes may have exited while we waited, so find the next
+       one by its position in the list. */
+    for(p = PROCESS_LIST(), i = 0; p != NULL && i < n; p = p->next, ++i);
+    if(p == NULL) {
+      break;
+    }
     shell_output_str(&ps_command, (char *)p->name, "");
   }
 
@@ -53,6 +53,8 @@
 
 #include "net/rime/timesynch.h"
 
+#include "collect-view-codec.h"
+
 #if CONTIKI_TARGET_NETSIM
 #include "ether.h"
 #endif /* CONTIKI_TARGET_NETSIM */
@@ -318,6 +320,9 @@ recv_collect(const rimeaddr_t *originator, u8_t seqno, u8_t hops)
       uint16_t hops;
       uint16_t latency;
     } msg;
+#if COLLECT_VIEW_COMPACT
+    struct collect_view_data_msg report;
+#endif /* COLLECT_VIEW_COMPACT */
 
     if(packetbuf_datalen() >= COLLECT_MSG_HDRSIZE) {
       len = packetbuf_datalen() - COLLECT_MSG_HDRSIZE;
@@ -328,6 +333,22 @@ recv_collect(const rimeaddr_t *originator, u8_t seqno, u8_t hops)
 	msg.seqno = seqno;
 	msg.hops = hops;
 	msg.latency = latency;
+
+#if COLLECT_VIEW_COMPACT
+	/* Compact collect view reports are printed as full reports, so
+	   that the collect view tool can read them. */
+	if(len > 0 &&
+	   ((uint8_t)dataptr[0] == COLLECT_VIEW_KEYFRAME ||
+	    (uint8_t)dataptr[0] == COLLECT_VIEW_DELTA)) {
+	  if(collect_view_decode_report(originator, (uint8_t *)dataptr, len,
+					&report)) {
+	    msg.len = 5 + sizeof(report) / 2;
+	    shell_output(&collect_command, &msg, sizeof(msg),
+			 &report, sizeof(report));
+	  }
+	  return;
+	}
+#endif /* COLLECT_VIEW_COMPACT */
 	
 	shell_output(&collect_command,
 		     &msg, sizeof(msg),
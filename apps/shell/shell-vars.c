@@ -70,7 +70,8 @@ SHELL_COMMAND(var_command,
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(shell_vars_process, ev, data)
 {
-  int i;
+  static int i;
+  static struct etimer etimer;
   
   PROCESS_BEGIN();
 
@@ -80,6 +81,7 @@ PROCESS_THREAD(shell_vars_process, ev, data)
     if(symbols[i].name != NULL &&
        (unsigned int)symbols[i].value >= SHELL_VARS_RAM_BEGIN &&
        (unsigned int)symbols[i].value <= SHELL_VARS_RAM_END) {
+      SHELL_OUTPUT_WAIT(&etimer);
       shell_output_str(&vars_command, (char *)symbols[i].name, "");
     }
   }
@@ -60,6 +60,8 @@ int shell_event_input;
 
 static struct process *front_process;
 
+static char output_ready;
+
 static unsigned long time_offset;
 
 PROCESS(shell_process, "Shell");
@@ -159,13 +161,15 @@ PROCESS_THREAD(shell_kill_process, ev, data)
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(help_command_process, ev, data)
 {
-  struct shell_command *c;
+  static struct shell_command *c;
+  static struct etimer etimer;
   PROCESS_BEGIN();
 
   shell_output_str(&help_command, "Available commands:", "");
   for(c = list_head(commands);
       c != NULL;
       c = c->next) {
+    SHELL_OUTPUT_WAIT(&etimer);
     shell_output_str(&help_command, c->description, "");
   }
   
@@ -490,6 +494,7 @@ shell_init(void)
   process_start(&shell_server_process, NULL);
 
   front_process = &shell_process;
+  output_ready = 1;
 }
 /*---------------------------------------------------------------------------*/
 unsigned long
@@ -542,6 +547,18 @@ shell_start(void)
 }
 /*---------------------------------------------------------------------------*/
 void
+shell_set_output_ready(int ready)
+{
+  output_ready = ready;
+}
+/*---------------------------------------------------------------------------*/
+int
+shell_output_ready(void)
+{
+  return output_ready;
+}
+/*---------------------------------------------------------------------------*/
+void
 shell_quit(void)
 {
   killall();
@@ -62,6 +62,7 @@
 #define __SHELL_H__
 
 #include "sys/process.h"
+#include "sys/etimer.h"
 
 /**
  * \brief      Holds a information about a shell command
@@ -128,6 +129,18 @@ void shell_input(char *commandline, int commandline_len);
  */
 void shell_quit(void);
 
+/**
+ * \brief      Tell the shell if the back-end can take more output
+ * \param ready Zero if the output buffer of the back-end is full
+ *
+ *             This function is called by a shell back-end with a
+ *             limited output buffer when the buffer fills up, and
+ *             again when it has room. Back-ends that never call this
+ *             function are always ready.
+ *
+ */
+void shell_set_output_ready(int ready);
+
 /**
  * @}
  */
@@ -216,6 +229,10 @@ static struct shell_command name = { NULL, command, \
  *             a static part (such as a static string) and a dynamic
  *             part (a dynamically generated string).
  *
+ *             The output is passed on at once, whether or not the
+ *             back-end is ready for it. Commands that output many
+ *             lines wait with SHELL_OUTPUT_WAIT() before each one.
+ *
  */
 void shell_output(struct shell_command *c,
 		  void *data1, int size1,
@@ -238,6 +255,37 @@ void shell_output(struct shell_command *c,
 void shell_output_str(struct shell_command *c,
 		      char *str1, const char *str2);
 
+/**
+ * \brief      Check if the shell back-end can take more output
+ * \retval     Non-zero if output will not be lost
+ *
+ *             This function is called by shell commands that output
+ *             a lot of data, such as file contents, in a loop. Such
+ *             commands should wait before they output more data when
+ *             the back-end is not ready.
+ *
+ */
+int shell_output_ready(void);
+
+/**
+ * \brief      Wait until the shell back-end can take more output
+ * \param et   A pointer to a static struct etimer
+ *
+ *             This macro is used in the process of a shell command
+ *             that outputs many lines, such as a listing, before
+ *             each line. It blocks the process until
+ *             shell_output_ready() returns non-zero, checking again
+ *             every 1/16 second. Local variables are not kept
+ *             across the wait.
+ *
+ * \hideinitializer
+ */
+#define SHELL_OUTPUT_WAIT(et)                           \
+  while(!shell_output_ready()) {                        \
+    etimer_set(et, CLOCK_SECOND / 16);                  \
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(et));       \
+  }
+
 /**
  * \brief      Register a command with the shell
  * \param c    A pointer to a shell command structure, defined with SHELL_COMMAND()
@@ -54,11 +54,16 @@ AUTOSTART_PROCESSES(&telnetd_process);
 #ifndef TELNETD_CONF_NUMLINES
 #define TELNETD_CONF_NUMLINES 25
 #endif
+/* How long output may wait for more output before it is sent. */
+#ifndef TELNETD_CONF_FLUSH_DELAY
+#define TELNETD_CONF_FLUSH_DELAY (CLOCK_SECOND / 32)
+#endif
 
 struct telnetd_state {
   char buf[TELNETD_CONF_LINELEN + 1];
   char bufptr;
   uint16_t numsent;
+  struct uip_conn *conn;
   u8_t state;
 #define STATE_NORMAL 0
 #define STATE_IAC    1
@@ -85,32 +90,44 @@ static struct telnetd_state s;
 #define PRINTF(...)
 #endif
 
+/* Output is kept in a ring buffer, from the first byte that has not
+   been acknowledged yet. */
 struct telnetd_buf {
   char bufmem[TELNETD_CONF_NUMLINES * TELNETD_CONF_LINELEN];
-  int ptr;
+  int head;
+  int len;
   int size;
 };
 
 static struct telnetd_buf buf;
 
+static struct ctimer flush_timer;
+
 #define MIN(a, b) ((a) < (b)? (a): (b))
 /*---------------------------------------------------------------------------*/
 static void
 buf_init(struct telnetd_buf *buf)
 {
-  buf->ptr = 0;
+  buf->head = 0;
+  buf->len = 0;
   buf->size = TELNETD_CONF_NUMLINES * TELNETD_CONF_LINELEN;
 }
 /*---------------------------------------------------------------------------*/
 static int
 buf_append(struct telnetd_buf *buf, const char *data, int len)
 {
-  int copylen;
+  int copylen, tail, firstlen;
 
-  PRINTF("buf_append len %d (%d) '%.*s'\n", len, buf->ptr, len, data);
-  copylen = MIN(len, buf->size - buf->ptr);
-  memcpy(&buf->bufmem[buf->ptr], data, copylen);
-  buf->ptr += copylen;
+  PRINTF("buf_append len %d (%d) '%.*s'\n", len, buf->len, len, data);
+  copylen = MIN(len, buf->size - buf->len);
+  tail = buf->head + buf->len;
+  if(tail >= buf->size) {
+    tail -= buf->size;
+  }
+  firstlen = MIN(copylen, buf->size - tail);
+  memcpy(&buf->bufmem[tail], data, firstlen);
+  memcpy(&buf->bufmem[0], data + firstlen, copylen - firstlen);
+  buf->len += copylen;
 
   return copylen;
 }
@@ -118,7 +135,11 @@ buf_append(struct telnetd_buf *buf, const char *data, int len)
 static void
 buf_copyto(struct telnetd_buf *buf, char *to, int len)
 {
-  memcpy(to, &buf->bufmem[0], len);
+  int firstlen;
+
+  firstlen = MIN(len, buf->size - buf->head);
+  memcpy(to, &buf->bufmem[buf->head], firstlen);
+  memcpy(to + firstlen, &buf->bufmem[0], len - firstlen);
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -126,16 +147,54 @@ buf_pop(struct telnetd_buf *buf, int len)
 {
   int poplen;
 
-  PRINTF("buf_pop len %d (%d)\n", len, buf->ptr);
-  poplen = MIN(len, buf->ptr);
-  memcpy(&buf->bufmem[0], &buf->bufmem[poplen], buf->ptr - poplen);
-  buf->ptr -= poplen;
+  PRINTF("buf_pop len %d (%d)\n", len, buf->len);
+  poplen = MIN(len, buf->len);
+  buf->head += poplen;
+  if(buf->head >= buf->size) {
+    buf->head -= buf->size;
+  }
+  buf->len -= poplen;
 }
 /*---------------------------------------------------------------------------*/
 static int
 buf_len(struct telnetd_buf *buf)
 {
-  return buf->ptr;
+  return buf->len;
+}
+/*---------------------------------------------------------------------------*/
+/* Shell commands that produce a lot of output hold back while less
+   than a quarter of the buffer is free, so that their output is not
+   cut off. The rest is left for commands that cannot wait. */
+static void
+update_ready(void)
+{
+  shell_set_output_ready(buf.size - buf.len >= buf.size / 4);
+}
+/*---------------------------------------------------------------------------*/
+static void
+flush_output(void *ptr)
+{
+  if(s.conn != NULL) {
+    tcpip_poll_tcp(s.conn);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Output is sent once a full segment has been collected, or after a
+   short delay, so that a burst of small writes goes out in a few
+   segments instead of waiting for the periodic poll. */
+static void
+output_added(void)
+{
+  update_ready();
+  if(s.conn == NULL) {
+    return;
+  }
+  if(buf_len(&buf) >= s.conn->mss) {
+    ctimer_stop(&flush_timer);
+    flush_output(NULL);
+  } else if(ctimer_expired(&flush_timer)) {
+    ctimer_set(&flush_timer, TELNETD_CONF_FLUSH_DELAY, flush_output, NULL);
+  }
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -153,6 +212,7 @@ void
 shell_prompt(char *str)
 {
   buf_append(&buf, str, (int)strlen(str));
+  output_added();
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -173,6 +233,7 @@ shell_default_output(const char *str1, int len1, const char *str2, int len2)
   buf_append(&buf, str1, len1);
   buf_append(&buf, str2, len2);
   buf_append(&buf, "\r\n", 2);
+  output_added();
 }
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(telnetd_process, ev, data)
@@ -181,6 +242,7 @@ PROCESS_THREAD(telnetd_process, ev, data)
   
   tcp_listen(UIP_HTONS(23));
   buf_init(&buf);
+  s.conn = NULL;
 
   shell_init();
 
@@ -208,22 +270,40 @@ static void
 acked(void)
 {
   buf_pop(&buf, s.numsent);
+  s.numsent = 0;
+  update_ready();
 }
 /*---------------------------------------------------------------------------*/
 static void
 senddata(void)
 {
   int len;
-  len = MIN(buf_len(&buf), uip_mss());
+
+  /* uIP has a single segment in flight. A retransmission must be the
+     same segment, and nothing new may be sent until it is acked. */
+  if(uip_rexmit()) {
+    len = s.numsent;
+  } else if(s.numsent > 0) {
+    return;
+  } else {
+    len = MIN(buf_len(&buf), uip_mss());
+  }
   PRINTF("senddata len %d\n", len);
-  buf_copyto(&buf, uip_appdata, len);
-  uip_send(uip_appdata, len);
+  if(len > 0) {
+    buf_copyto(&buf, uip_appdata, len);
+    uip_send(uip_appdata, len);
+  }
   s.numsent = len;
 }
 /*---------------------------------------------------------------------------*/
 static void
 closed(void)
 {
+  s.conn = NULL;
+  ctimer_stop(&flush_timer);
+  buf_init(&buf);
+  s.numsent = 0;
+  update_ready();
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -260,6 +340,7 @@ sendopt(u8_t option, u8_t value)
   line[2] = value;
   line[3] = 0;
   buf_append(&buf, line, 4);
+  output_added();
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -341,6 +422,8 @@ telnetd_appcall(void *ts)
   if(uip_connected()) {
     tcp_markconn(uip_conn, &s);
     buf_init(&buf);
+    s.conn = uip_conn;
+    s.numsent = 0;
     s.bufptr = 0;
     s.state = STATE_NORMAL;
     shell_start();
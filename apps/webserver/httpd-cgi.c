@@ -125,13 +125,22 @@ httpd_cgi(char *name)
 {
   struct httpd_cgi_call *f;
 
-  /* Find the matching name in the table, return the function. */
+  f = httpd_cgi_find(name);
+  return f != NULL ? f->function : nullfunction;
+}
+/*---------------------------------------------------------------------------*/
+struct httpd_cgi_call *
+httpd_cgi_find(char *name)
+{
+  struct httpd_cgi_call *f;
+
+  /* Find the matching name in the table. */
   for(f = calls; f != NULL; f = f->next) {
     if(strncmp(f->name, name, strlen(f->name)) == 0) {
-      return f->function;
+      return f;
     }
   }
-  return nullfunction;
+  return NULL;
 }
 /*---------------------------------------------------------------------------*/
 static unsigned short
@@ -244,8 +253,8 @@ httpd_cgi_add(struct httpd_cgi_call *c)
 /*---------------------------------------------------------------------------*/
 
 HTTPD_CGI_CALL(file, file_name, file_stats);
-HTTPD_CGI_CALL(tcp, tcp_name, tcp_stats);
-HTTPD_CGI_CALL(proc, proc_name, processes);
+HTTPD_CGI_CALL_TTL(tcp, tcp_name, tcp_stats, 2);
+HTTPD_CGI_CALL_TTL(proc, proc_name, processes, 10);
 
 void
 httpd_cgi_init(void)
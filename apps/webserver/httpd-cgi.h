@@ -46,12 +46,31 @@ struct httpd_cgi_call {
   struct httpd_cgi_call *next;
   const char *name;
   httpd_cgifunction function;
+  unsigned short ttl;
+  unsigned short generation;
 };
 
 void httpd_cgi_add(struct httpd_cgi_call *c);
 
+/* Returns the script call that matches name, or NULL. */
+struct httpd_cgi_call *httpd_cgi_find(char *name);
+
+/* Returns the script call with the given index in a segment table made
+   by makefsdata -x (see httpd-fsdata.h), or NULL. The name is only
+   looked up the first time. */
+struct httpd_cgi_call *httpd_fs_script(unsigned char index);
+
 #define HTTPD_CGI_CALL(name, str, function) \
 static struct httpd_cgi_call name = {NULL, str, function}
 
+/* Declares a script call whose output the web server may cache for
+   ttl seconds, or until httpd_cgi_changed() is called for it. */
+#define HTTPD_CGI_CALL_TTL(name, str, function, ttl) \
+static struct httpd_cgi_call name = {NULL, str, function, ttl}
+
+/* Tells the web server that the output of a script call has
+   changed. */
+#define httpd_cgi_changed(c) (++(c)->generation)
+
 void httpd_cgi_init(void);
 #endif /* __HTTPD_CGI_H__ */
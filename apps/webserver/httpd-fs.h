@@ -42,6 +42,7 @@
 struct httpd_fs_file {
   char *data;
   int len;
+  const struct httpd_fsdata_segment *segments;
 };
 
 /* file must be allocated by caller and will be filled in
@@ -37,11 +37,26 @@
 
 #include "contiki-net.h"
 
+/*
+ * A .shtml file precompiled by makefsdata -x is served as a list of
+ * segments, ended by one with a NULL data pointer. A segment is either
+ * a static span of data, or a script call whose function is found
+ * through its index in httpd_fsdata_scripts[].
+ */
+struct httpd_fsdata_segment {
+  const char *data;
+  unsigned short len;
+  unsigned char script;
+};
+
+#define HTTPD_FSDATA_STATIC 0xff
+
 struct httpd_fsdata_file {
   const struct httpd_fsdata_file *next;
   const char *name;
   const char *data;
   const int len;
+  const struct httpd_fsdata_segment *segments;
 #ifdef HTTPD_FS_STATISTICS
 #if HTTPD_FS_STATISTICS == 1
   u16_t count;
@@ -54,6 +69,7 @@ struct httpd_fsdata_file_noconst {
   char *name;
   char *data;
   int len;
+  struct httpd_fsdata_segment *segments;
 #ifdef HTTPD_FS_STATISTICS
 #if HTTPD_FS_STATISTICS == 1
   u16_t count;
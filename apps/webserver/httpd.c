@@ -37,9 +37,12 @@
 #include <string.h>
 
 #include "contiki-net.h"
+#include "lib/random.h"
+#include "sys/stimer.h"
 
 #include "webserver.h"
 #include "httpd-fs.h"
+#include "httpd-fsdata.h"
 #include "httpd-cgi.h"
 #include "lib/petsciiconv.h"
 #include "http-strings.h"
@@ -52,19 +55,273 @@
 #define CONNS WEBSERVER_CONF_CGI_CONNS
 #endif /* WEBSERVER_CONF_CGI_CONNS */
 
+#ifdef WEBSERVER_CONF_CACHE_ENTRIES
+#define CACHE_ENTRIES WEBSERVER_CONF_CACHE_ENTRIES
+#else /* WEBSERVER_CONF_CACHE_ENTRIES */
+#define CACHE_ENTRIES 4
+#endif /* WEBSERVER_CONF_CACHE_ENTRIES */
+
+/* Bytes of script output kept for each cached page. With 0, pages are
+   only tagged, so that unchanged ones can be answered with 304. */
+#ifdef WEBSERVER_CONF_CACHE_SIZE
+#define CACHE_SIZE WEBSERVER_CONF_CACHE_SIZE
+#else /* WEBSERVER_CONF_CACHE_SIZE */
+#define CACHE_SIZE 0
+#endif /* WEBSERVER_CONF_CACHE_SIZE */
+
 #define STATE_WAITING 0
 #define STATE_OUTPUT  1
 
+#define CACHE_NONE    0
+#define CACHE_CAPTURE 1
+#define CACHE_SCRIPT  2
+#define CACHE_REPLAY  3
+
+#define CACHE_NO_BODY 0xffff
+
+/* A page made from script output. The body holds the output of each
+   script on the page, in order, each prefixed by its length; the
+   static parts are still sent from the file system. */
+struct httpd_cache {
+  const struct httpd_fsdata_segment *page;
+  struct stimer timer;
+  unsigned short stamp;
+  unsigned short version;
+#if CACHE_SIZE > 0
+  unsigned short len;
+  unsigned char readers;
+  unsigned char filling;
+  char body[CACHE_SIZE];
+#endif /* CACHE_SIZE > 0 */
+};
+
+static struct httpd_cache cache[CACHE_ENTRIES];
+static unsigned short cache_boot, cache_version;
+
 #define SEND_STRING(s, str) PSOCK_SEND(s, (uint8_t *)str, (unsigned int)strlen(str))
 MEMB(conns, struct httpd_state, CONNS);
 
 #define ISO_nl      0x0a
+#define ISO_cr      0x0d
 #define ISO_space   0x20
 #define ISO_bang    0x21
 #define ISO_percent 0x25
 #define ISO_period  0x2e
 #define ISO_slash   0x2f
 #define ISO_colon   0x3a
+#define ISO_quote   0x22
+
+/*---------------------------------------------------------------------------*/
+static unsigned long
+cache_tag(unsigned short version)
+{
+  return ((unsigned long)cache_boot << 16) | version;
+}
+/*---------------------------------------------------------------------------*/
+#if CACHE_SIZE > 0
+static int
+cache_busy(struct httpd_cache *e)
+{
+  return e->readers > 0 || e->filling;
+}
+/*---------------------------------------------------------------------------*/
+static void
+cache_release(struct httpd_state *s)
+{
+  if(s->cache != NULL) {
+    if(s->cachemode == CACHE_REPLAY) {
+      --s->cache->readers;
+    } else {
+      /* Unless the capture was finished, the page is left without a
+	 body. */
+      s->cache->filling = 0;
+    }
+    s->cache = NULL;
+  }
+  s->cachemode = CACHE_NONE;
+}
+/*---------------------------------------------------------------------------*/
+static void
+cache_chunk_begin(struct httpd_state *s)
+{
+  if(s->cachemode == CACHE_CAPTURE) {
+    if(s->cachepos + 2 > CACHE_SIZE) {
+      cache_release(s);
+      return;
+    }
+    s->cachechunk = s->cachepos;
+    s->cachepos += 2;
+    s->cachemode = CACHE_SCRIPT;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+cache_chunk_end(struct httpd_state *s)
+{
+  unsigned short len;
+
+  if(s->cachemode == CACHE_SCRIPT) {
+    len = s->cachepos - s->cachechunk - 2;
+    memcpy(&s->cache->body[s->cachechunk], &len, 2);
+    s->cachemode = CACHE_CAPTURE;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+cache_chunk_replay(struct httpd_state *s)
+{
+  unsigned short len;
+
+  memcpy(&len, &s->cache->body[s->cachepos], 2);
+  s->file.data = &s->cache->body[s->cachepos + 2];
+  s->file.len = len;
+  s->cachepos += 2 + len;
+}
+/*---------------------------------------------------------------------------*/
+/* Copies what a script has just sent into the page being captured.
+   Retransmissions are skipped, as their data has been copied
+   already. */
+static void
+cache_capture(struct httpd_state *s)
+{
+  unsigned short len;
+
+  if(s->cachemode == CACHE_SCRIPT) {
+    len = PSOCK_SENTLEN(&s->sout);
+    if(s->cachepos + len > CACHE_SIZE) {
+      cache_release(s);
+    } else {
+      memcpy(&s->cache->body[s->cachepos], uip_appdata, len);
+      s->cachepos += len;
+    }
+  }
+}
+#else /* CACHE_SIZE > 0 */
+#define cache_busy(e) 0
+#define cache_release(s)
+#define cache_capture(s)
+#endif /* CACHE_SIZE > 0 */
+/*---------------------------------------------------------------------------*/
+/* Finds the ETag of the file that s is about to send. A page made by
+   makefsdata -x whose scripts all have a TTL keeps its ETag for the
+   shortest of the TTLs, or until one of its scripts is marked as
+   changed; if there is room, the script output is kept as well. Other
+   files in the file system never change, so their ETag is taken from
+   where they are. */
+static void
+cache_lookup(struct httpd_state *s)
+{
+  const struct httpd_fsdata_segment *seg;
+  struct httpd_cgi_call *c;
+  struct httpd_cache *e, *victim;
+  unsigned short ttl, stamp;
+  char *ptr;
+
+  s->tag = 0;
+  s->cache = NULL;
+  s->cachemode = CACHE_NONE;
+
+  if(s->file.segments == NULL) {
+    ptr = strrchr(s->filename, ISO_period);
+    if(ptr == NULL || strncmp(ptr, http_shtml, 6) != 0) {
+      s->tag = cache_tag((unsigned short)((size_t)s->file.data ^ s->file.len));
+    }
+    return;
+  }
+
+  ttl = 0xffff;
+  stamp = 0;
+  for(seg = s->file.segments; seg->data != NULL; ++seg) {
+    if(seg->script != HTTPD_FSDATA_STATIC &&
+       (c = httpd_fs_script(seg->script)) != NULL) {
+      if(c->ttl < ttl) {
+	ttl = c->ttl;
+      }
+      stamp += c->generation;
+    }
+  }
+  if(ttl == 0) {
+    return;
+  }
+
+  victim = NULL;
+  for(e = cache; e < &cache[CACHE_ENTRIES]; ++e) {
+    if(e->page == s->file.segments) {
+      break;
+    }
+    if(!cache_busy(e) &&
+       (victim == NULL ||
+	(victim->page != NULL &&
+	 (e->page == NULL || (short)(e->version - victim->version) < 0)))) {
+      victim = e;
+    }
+  }
+
+  if(e < &cache[CACHE_ENTRIES]) {
+    if(!stimer_expired(&e->timer) && e->stamp == stamp) {
+      s->tag = cache_tag(e->version);
+#if CACHE_SIZE > 0
+      if(e->len != CACHE_NO_BODY) {
+	++e->readers;
+	s->cache = e;
+	s->cachemode = CACHE_REPLAY;
+	s->cachepos = 0;
+      }
+#endif /* CACHE_SIZE > 0 */
+      return;
+    }
+    if(cache_busy(e)) {
+      /* Out of date, but still being sent or captured. */
+      return;
+    }
+    victim = e;
+  }
+  if(victim == NULL) {
+    return;
+  }
+
+  e = victim;
+  e->page = s->file.segments;
+  stimer_set(&e->timer, ttl);
+  e->stamp = stamp;
+  e->version = ++cache_version;
+  s->tag = cache_tag(e->version);
+#if CACHE_SIZE > 0
+  e->len = CACHE_NO_BODY;
+  e->filling = 1;
+  s->cache = e;
+  s->cachemode = CACHE_CAPTURE;
+  s->cachepos = 0;
+#endif /* CACHE_SIZE > 0 */
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+parse_etag(char *ptr)
+{
+  unsigned long tag;
+  unsigned char i;
+  char c;
+
+  while(*ptr == ISO_space) {
+    ++ptr;
+  }
+  if(*ptr++ != ISO_quote) {
+    return 0;
+  }
+  tag = 0;
+  for(i = 0; i < 8; ++i) {
+    c = *ptr++;
+    if(c >= '0' && c <= '9') {
+      c -= '0';
+    } else if(c >= 'a' && c <= 'f') {
+      c -= 'a' - 10;
+    } else {
+      return 0;
+    }
+    tag = (tag << 4) | c;
+  }
+  return *ptr == ISO_quote ? tag : 0;
+}
 
 /*---------------------------------------------------------------------------*/
 static unsigned short
@@ -182,6 +439,60 @@ PT_THREAD(handle_script(struct httpd_state *s))
   PT_END(&s->scriptpt);
 }
 /*---------------------------------------------------------------------------*/
+/* Serves a .shtml file from the segment table made by makefsdata -x,
+   so the file does not have to be searched for scripts. */
+static
+PT_THREAD(handle_segments(struct httpd_state *s))
+{
+  PT_BEGIN(&s->scriptpt);
+
+  for(s->segment = s->file.segments;
+      s->segment->data != NULL;
+      ++s->segment) {
+    if(s->segment->script == HTTPD_FSDATA_STATIC) {
+      s->file.data = (char *)s->segment->data;
+      s->file.len = s->segment->len;
+      PT_WAIT_THREAD(&s->scriptpt, send_file(s));
+    } else if(httpd_fs_script(s->segment->script) != NULL) {
+#if CACHE_SIZE > 0
+      if(s->cachemode == CACHE_REPLAY) {
+	cache_chunk_replay(s);
+	if(s->file.len > 0) {
+	  PT_WAIT_THREAD(&s->scriptpt, send_file(s));
+	}
+	continue;
+      }
+      cache_chunk_begin(s);
+#endif /* CACHE_SIZE > 0 */
+      s->scriptptr = (char *)s->segment->data;
+      PT_WAIT_THREAD(&s->scriptpt,
+		     httpd_fs_script(s->segment->script)->function(s, s->scriptptr));
+#if CACHE_SIZE > 0
+      cache_chunk_end(s);
+#endif /* CACHE_SIZE > 0 */
+    }
+  }
+#if CACHE_SIZE > 0
+  if(s->cachemode == CACHE_CAPTURE) {
+    s->cache->len = s->cachepos;
+  }
+#endif /* CACHE_SIZE > 0 */
+  cache_release(s);
+
+  PT_END(&s->scriptpt);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned short
+generate_etag(void *state)
+{
+  struct httpd_state *s = (struct httpd_state *)state;
+
+  /* no-cache makes the client revalidate with the ETag every time.
+     Responses without an ETag get neither header. */
+  return sprintf((char *)uip_appdata,
+		 "ETag: \"%08lx\"\r\nCache-Control: no-cache\r\n", s->tag);
+}
+/*---------------------------------------------------------------------------*/
 static
 PT_THREAD(send_headers(struct httpd_state *s, const char *statushdr))
 {
@@ -194,6 +505,10 @@ PT_THREAD(send_headers(struct httpd_state *s, const char *statushdr))
 
   SEND_STRING(&s->sout, statushdr);
 
+  if(s->tag != 0) {
+    PSOCK_GENERATOR_SEND(&s->sout, generate_etag, s);
+  }
+
   ptr = strrchr(s->filename, ISO_period);
   if(ptr == NULL) {
     ptr = http_content_type_binary;
@@ -222,6 +537,7 @@ PT_THREAD(handle_output(struct httpd_state *s))
   
   PT_BEGIN(&s->outputpt);
  
+  s->tag = 0;
   if(!httpd_fs_open(s->filename, &s->file)) {
     strcpy(s->filename, http_404_html);
     httpd_fs_open(s->filename, &s->file);
@@ -231,11 +547,25 @@ PT_THREAD(handle_output(struct httpd_state *s))
     PT_WAIT_THREAD(&s->outputpt,
 		   send_file(s));
   } else {
+    cache_lookup(s);
+    if(s->tag != 0 && s->tag == s->etag) {
+      /* The client has this version already, so there is no need to
+	 run the scripts. */
+      cache_release(s);
+      PT_WAIT_THREAD(&s->outputpt,
+		     send_headers(s,
+		     http_header_304));
+      PSOCK_CLOSE(&s->sout);
+      PT_EXIT(&s->outputpt);
+    }
     PT_WAIT_THREAD(&s->outputpt,
 		   send_headers(s,
 		   http_header_200));
     ptr = strrchr(s->filename, ISO_period);
-    if(ptr != NULL && strncmp(ptr, http_shtml, 6) == 0) {
+    if(s->file.segments != NULL) {
+      PT_INIT(&s->scriptpt);
+      PT_WAIT_THREAD(&s->outputpt, handle_segments(s));
+    } else if(ptr != NULL && strncmp(ptr, http_shtml, 6) == 0) {
       PT_INIT(&s->scriptpt);
       PT_WAIT_THREAD(&s->outputpt, handle_script(s));
     } else {
@@ -273,15 +603,22 @@ PT_THREAD(handle_input(struct httpd_state *s))
   petsciiconv_topetscii(s->filename, sizeof(s->filename));
   webserver_log_file(&uip_conn->ripaddr, s->filename);
   petsciiconv_toascii(s->filename, sizeof(s->filename));
-  s->state = STATE_OUTPUT;
 
+  /* The output is started only at the blank line that ends the
+     headers, so that If-None-Match is seen even if the request comes
+     in several segments. */
   while(1) {
     PSOCK_READTO(&s->sin, ISO_nl);
 
-    if(strncmp(s->inputbuf, http_referer, 8) == 0) {
+    if(s->inputbuf[0] == ISO_nl ||
+       (s->inputbuf[0] == ISO_cr && s->inputbuf[1] == ISO_nl)) {
+      s->state = STATE_OUTPUT;
+    } else if(strncmp(s->inputbuf, http_referer, 8) == 0) {
       s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
       petsciiconv_topetscii(s->inputbuf, PSOCK_DATALEN(&s->sin) - 2);
       webserver_log(s->inputbuf);
+    } else if(strncmp(s->inputbuf, http_if_none_match, 14) == 0) {
+      s->etag = parse_etag(s->inputbuf + 14);
     }
   }
   
@@ -304,6 +641,7 @@ httpd_appcall(void *state)
 
   if(uip_closed() || uip_aborted() || uip_timedout()) {
     if(s != NULL) {
+      cache_release(s);
       memb_free(&conns, s);
     }
   } else if(uip_connected()) {
@@ -317,6 +655,9 @@ httpd_appcall(void *state)
     PSOCK_INIT(&s->sout, (uint8_t *)s->inputbuf, sizeof(s->inputbuf) - 1);
     PT_INIT(&s->outputpt);
     s->state = STATE_WAITING;
+    s->cache = NULL;
+    s->cachemode = CACHE_NONE;
+    s->etag = 0;
     /*    timer_set(&s->timer, CLOCK_SECOND * 100);*/
     s->timer = 0;
     handle_connection(s);
@@ -325,12 +666,15 @@ httpd_appcall(void *state)
       ++s->timer;
       if(s->timer >= 20) {
 	uip_abort();
+	cache_release(s);
 	memb_free(&conns, s);
+	return;
       }
     } else {
       s->timer = 0;
     }
     handle_connection(s);
+    cache_capture(s);
   } else {
     uip_abort();
   }
@@ -342,6 +686,7 @@ httpd_init(void)
   tcp_listen(UIP_HTONS(80));
   memb_init(&conns);
   httpd_cgi_init();
+  cache_boot = random_rand() | 1;
 }
 #if UIP_CONF_IPV6
 /*---------------------------------------------------------------------------*/
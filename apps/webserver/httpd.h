@@ -39,6 +39,8 @@
 #include "contiki-net.h"
 #include "httpd-fs.h"
 
+struct httpd_cache;
+
 struct httpd_state {
   unsigned char timer;
   struct psock sin, sout;
@@ -50,6 +52,11 @@ struct httpd_state {
   int len;
   char *scriptptr;
   int scriptlen;
+  const struct httpd_fsdata_segment *segment;
+  struct httpd_cache *cache;
+  unsigned long etag, tag;
+  unsigned short cachepos, cachechunk;
+  unsigned char cachemode;
   union {
     unsigned short count;
     void *ptr;
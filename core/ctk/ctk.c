@@ -85,12 +85,30 @@ static unsigned char maxnitems;
 #define REDRAW_WIDGETS      4
 #define REDRAW_MENUS        8
 #define REDRAW_MENUPART     16
+#define REDRAW_DAMAGE       32
 
-#define MAX_REDRAWWIDGETS 4
+#define MAX_REDRAWWIDGETS CTK_CONF_MAX_REDRAWWIDGETS
 static unsigned char redraw;
 static struct ctk_widget *redraw_widgets[MAX_REDRAWWIDGETS];
 static unsigned char redraw_widgetptr;
 
+#if CTK_CONF_WINDOWS
+/* A part of the screen to be repainted, in screen characters. The x2
+   and y2 edges are not included. */
+struct ctk_rect {
+  unsigned char x1, y1, x2, y2;
+};
+static struct ctk_rect damage[CTK_CONF_DAMAGE_RECTS];
+static unsigned char ndamage;
+#endif /* CTK_CONF_WINDOWS */
+
+#if CTK_CONF_STATISTICS
+struct ctk_stat ctk_stat;
+#define CTK_STAT(s) s
+#else /* CTK_CONF_STATISTICS */
+#define CTK_STAT(s)
+#endif /* CTK_CONF_STATISTICS */
+
 #if CTK_CONF_ICONS
 static unsigned char iconx, icony;
 #define ICONX_START  (width - 6)
@@ -312,6 +330,94 @@ ctk_icon_add(CC_REGISTER_ARG struct ctk_widget *icon, struct process *p)
 }
 #if CTK_CONF_WINDOWS
 /*---------------------------------------------------------------------------*/
+/**
+ * \internal Gets the screen area covered by a window, including its
+ * borders and title bar.
+ */
+/*---------------------------------------------------------------------------*/
+static void
+window_rect(struct ctk_window *w, struct ctk_rect *r)
+{
+  r->x1 = w->x;
+  r->y1 = w->y + CTK_CONF_MENUS;
+  r->x2 = w->x + w->w + 2 * ctk_draw_windowborder_width;
+  r->y2 = r->y1 + w->h +
+    ctk_draw_windowtitle_height + ctk_draw_windowborder_height;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned char
+rect_overlaps(struct ctk_rect *a, struct ctk_rect *b)
+{
+  return a->x1 < b->x2 && b->x1 < a->x2 &&
+    a->y1 < b->y2 && b->y1 < a->y2;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned char
+rect_contains(struct ctk_rect *a, struct ctk_rect *b)
+{
+  return a->x1 <= b->x1 && a->y1 <= b->y1 &&
+    a->x2 >= b->x2 && a->y2 >= b->y2;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \internal Marks an area of the screen to be repainted.
+ *
+ * When the list of damaged areas is full, the area is merged with the
+ * first one on the list.
+ */
+/*---------------------------------------------------------------------------*/
+static void
+add_damage(struct ctk_rect *r)
+{
+  struct ctk_rect *d;
+  unsigned char i;
+
+  redraw |= REDRAW_DAMAGE;
+
+  for(i = 0; i < ndamage; ++i) {
+    d = &damage[i];
+    if(rect_contains(d, r)) {
+      return;
+    }
+    if(rect_contains(r, d)) {
+      *d = *r;
+      return;
+    }
+  }
+
+  if(ndamage < CTK_CONF_DAMAGE_RECTS) {
+    damage[ndamage++] = *r;
+  } else {
+    d = &damage[0];
+    if(r->x1 < d->x1) {
+      d->x1 = r->x1;
+    }
+    if(r->y1 < d->y1) {
+      d->y1 = r->y1;
+    }
+    if(r->x2 > d->x2) {
+      d->x2 = r->x2;
+    }
+    if(r->y2 > d->y2) {
+      d->y2 = r->y2;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \internal Marks the area of a window, at its current position, to
+ * be repainted.
+ */
+/*---------------------------------------------------------------------------*/
+static void
+damage_window(struct ctk_window *w)
+{
+  struct ctk_rect r;
+
+  window_rect(w, &r);
+  add_damage(&r);
+}
+/*---------------------------------------------------------------------------*/
 /**
  * Open a dialog box.
  *
@@ -349,6 +455,11 @@ ctk_window_open(CC_REGISTER_ARG struct ctk_window *w)
 {
 #if CTK_CONF_WINDOWS
   struct ctk_window *w2;
+
+  /* The window that loses focus is drawn again without it. */
+  if(windows != NULL && windows != w) {
+    damage_window(windows);
+  }
   
   /* Check if already open. */
   for(w2 = windows; w2 != w && w2 != NULL; w2 = w2->next);
@@ -386,7 +497,11 @@ ctk_window_open(CC_REGISTER_ARG struct ctk_window *w)
   make_desktopmenu();
 #endif /* CTK_CONF_MENUS */
 
+#if CTK_CONF_WINDOWS
+  damage_window(w);
+#else /* CTK_CONF_WINDOWS */
   redraw |= REDRAW_ALL;
+#endif /* CTK_CONF_WINDOWS */
 }
 /*---------------------------------------------------------------------------*/
 /**
@@ -412,6 +527,8 @@ ctk_window_close(struct ctk_window *w)
     windows = w->next;
     if(windows != NULL) {
       windows->prev = NULL;
+      /* The window below gets the focus. */
+      damage_window(windows);
     }
     w->next = w->prev = NULL;
   } else {
@@ -437,7 +554,7 @@ ctk_window_close(struct ctk_window *w)
   /* Recreate the Desktop menu's window entries.*/
   make_desktopmenu();
 #endif /* CTK_CONF_MENUS */
-  redraw |= REDRAW_ALL;
+  damage_window(w);
 #endif /* CTK_CONF_WINDOWCLOSE */
 }
 #if CTK_CONF_WINDOWS
@@ -570,12 +687,14 @@ do_redraw_all(unsigned char clipy1, unsigned char clipy2)
   }
   
   ctk_draw_clear(clipy1, clipy2);
+  CTK_STAT(++ctk_stat.clears);
 
 #if CTK_CONF_WINDOWS  
   /* Draw widgets in root window */
   for(widget = desktop_window.active;
       widget != NULL; widget = widget->next) {
     ctk_draw_widget(widget, windows != NULL? 0: CTK_FOCUS_WINDOW, clipy1, clipy2);
+    CTK_STAT(++ctk_stat.widgets);
   }
 
   /* Draw windows */
@@ -587,6 +706,8 @@ do_redraw_all(unsigned char clipy1, unsigned char clipy2)
     for(; w != windows; w = w->prev) {
       ctk_draw_clear_window(w, 0, clipy1, clipy2);
       ctk_draw_window(w, 0, clipy1, clipy2, 1);
+      CTK_STAT(++ctk_stat.clears);
+      CTK_STAT(++ctk_stat.windows);
     }
 
     /* Draw focused window */
@@ -595,6 +716,8 @@ do_redraw_all(unsigned char clipy1, unsigned char clipy2)
 	    CTK_FOCUS_WINDOW;
     ctk_draw_clear_window(windows, focus, clipy1, clipy2);
     ctk_draw_window(windows, focus, clipy1, clipy2, 1);
+    CTK_STAT(++ctk_stat.clears);
+    CTK_STAT(++ctk_stat.windows);
   }
 
   /* Draw dialog (if any) */
@@ -605,6 +728,8 @@ do_redraw_all(unsigned char clipy1, unsigned char clipy2)
   if(window != NULL) {
     ctk_draw_clear_window(window, CTK_FOCUS_WINDOW, clipy1, clipy2);
     ctk_draw_window(window, CTK_FOCUS_WINDOW, clipy1, clipy2, 0);
+    CTK_STAT(++ctk_stat.clears);
+    CTK_STAT(++ctk_stat.windows);
   }
 #endif /* CTK_CONF_WINDOWS */
 
@@ -614,6 +739,111 @@ do_redraw_all(unsigned char clipy1, unsigned char clipy2)
 }
 #if CTK_CONF_WINDOWS
 /*---------------------------------------------------------------------------*/
+/**
+ * \internal Repaints one damaged area of the screen.
+ *
+ * The back-end can only clip drawing to a band of rows, so a window
+ * that is drawn is drawn across its full width within the rows of the
+ * area. If a window covers the whole area, nothing below it can show
+ * through and only that window and the windows above it that overlap
+ * what is being drawn are repainted. Otherwise the rows are cleared
+ * and every window in them is drawn.
+ *
+ * \param r The damaged area.
+ */
+/*---------------------------------------------------------------------------*/
+static void
+redraw_damage(struct ctk_rect *r)
+{
+  static struct ctk_widget *widget;
+  struct ctk_window *w, *last;
+  struct ctk_rect wr, painted;
+  unsigned char focus;
+
+  /* Find the window closest to the front that covers the area. */
+  for(last = windows; last != NULL; last = last->next) {
+    window_rect(last, &wr);
+    if(rect_contains(&wr, r)) {
+      break;
+    }
+  }
+
+  painted = *r;
+  if(last == NULL) {
+    ctk_draw_clear(r->y1, r->y2);
+    CTK_STAT(++ctk_stat.clears);
+    for(widget = desktop_window.active;
+	widget != NULL; widget = widget->next) {
+      ctk_draw_widget(widget, windows != NULL? 0: CTK_FOCUS_WINDOW,
+		      r->y1, r->y2);
+      CTK_STAT(++ctk_stat.widgets);
+    }
+    if(windows == NULL) {
+      return;
+    }
+    painted.x1 = 0;
+    painted.x2 = width;
+    for(last = windows; last->next != NULL; last = last->next);
+  }
+
+  /* Draw from back to front every window that overlaps something that
+     has been painted. */
+  for(w = last; w != NULL; w = w->prev) {
+    window_rect(w, &wr);
+    if(!rect_overlaps(&wr, &painted)) {
+      continue;
+    }
+    if(w == windows) {
+      focus = mode == CTK_MODE_WINDOWMOVE?
+	CTK_FOCUS_WIDGET|CTK_FOCUS_WINDOW:
+	CTK_FOCUS_WINDOW;
+    } else {
+      focus = 0;
+    }
+    ctk_draw_clear_window(w, focus, r->y1, r->y2);
+    ctk_draw_window(w, focus, r->y1, r->y2, 1);
+    CTK_STAT(++ctk_stat.clears);
+    CTK_STAT(++ctk_stat.windows);
+
+    if(wr.x1 < painted.x1) {
+      painted.x1 = wr.x1;
+    }
+    if(wr.x2 > painted.x2) {
+      painted.x2 = wr.x2;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \internal Repaints the areas of the screen that have been damaged by
+ * windows being opened, closed, raised or moved.
+ */
+/*---------------------------------------------------------------------------*/
+static void
+do_redraw_damage(void)
+{
+  unsigned char i;
+
+  if(mode != CTK_MODE_NORMAL && mode != CTK_MODE_WINDOWMOVE) {
+    return;
+  }
+
+  /* The dialog is drawn on top of everything, so it takes a full
+     redraw. */
+  if(dialog != NULL) {
+    do_redraw_all(CTK_CONF_MENUS, height);
+    return;
+  }
+
+  for(i = 0; i < ndamage; ++i) {
+    redraw_damage(&damage[i]);
+  }
+
+#if CTK_CONF_MENUS
+  ctk_draw_menus(&menus);
+#endif /* CTK_CONF_MENUS */
+}
+/*---------------------------------------------------------------------------*/
 /**
  * Redraw the entire desktop.
  *
@@ -669,6 +899,7 @@ ctk_window_redraw(struct ctk_window *w)
 #endif /* CTK_CONF_WINDOWS */
   {
     ctk_draw_window(w, CTK_FOCUS_WINDOW, 0, height, 0);
+    CTK_STAT(++ctk_stat.windows);
   }
 }
 /*---------------------------------------------------------------------------*/
@@ -875,12 +1106,14 @@ widget_redraw(struct ctk_widget *widget)
 #if CTK_CONF_WINDOWS
     if(window == dialog) {
       ctk_draw_widget(widget, CTK_FOCUS_DIALOG, 0, height);
+      CTK_STAT(++ctk_stat.widgets);
     } else if(dialog == NULL &&
 	      (window == windows ||
 	       window == &desktop_window))
 #endif /* CTK_CONF_WINDOWS */
     {
       ctk_draw_widget(widget, CTK_FOCUS_WINDOW, 0, height);
+      CTK_STAT(++ctk_stat.widgets);
     }
   }
 }
@@ -1135,13 +1368,14 @@ activate(CC_REGISTER_ARG struct ctk_widget *w)
     if(w == (struct ctk_widget *)&windows->closebutton) {
       process_post(w->window->owner, ctk_signal_window_close, windows);
       ctk_window_close(windows);
-      return REDRAW_ALL;
+      return REDRAW_NONE;
     } else
 #endif /* CTK_CONF_WINDOWCLOSE */
 #if CTK_CONF_WINDOWMOVE
     if(w == (struct ctk_widget *)&windows->titlebutton) {
       mode = CTK_MODE_WINDOWMOVE;
-      return REDRAW_ALL;
+      damage_window(windows);
+      return REDRAW_NONE;
     } else
 #endif /* CTK_CONF_WINDOWMOVE */
     {
@@ -1368,6 +1602,9 @@ PROCESS_THREAD(ctk_process, ev, data)
 #if CTK_CONF_WINDOWS
   register struct ctk_window *window;
 #endif /* CTK_CONF_WINDOWS */
+#if CTK_CONF_WINDOWMOVE
+  static struct ctk_rect moverect;
+#endif /* CTK_CONF_WINDOWMOVE */
   register struct ctk_widget *widget;
   register struct ctk_widget **widgetptr;
 #if CTK_CONF_MOUSE_SUPPORT
@@ -1627,7 +1864,6 @@ PROCESS_THREAD(ctk_process, ev, data)
 		   mouse_clicked) {
 		  /* Bring window to front. */
 		  ctk_window_open(window);
-		  redraw |= REDRAW_ALL;
 		} else {
 
 		  /* Find out which widget currently is under the mouse
@@ -1810,6 +2046,7 @@ PROCESS_THREAD(ctk_process, ev, data)
 	redraw = 0;
 
 	window = windows;
+	window_rect(window, &moverect);
 
 #if CTK_CONF_MOUSE_SUPPORT
 
@@ -1835,7 +2072,6 @@ PROCESS_THREAD(ctk_process, ev, data)
 	  }
 #endif /* CTK_CONF_MENUS */
 
-	  redraw = REDRAW_ALL;
 	}
     
 	/* Check if the mouse has been clicked, and stop moving the window
@@ -1843,7 +2079,7 @@ PROCESS_THREAD(ctk_process, ev, data)
 	if(mouse_button_changed &&
 	   mouse_button == 0) {
 	  mode = CTK_MODE_NORMAL;
-	  redraw = REDRAW_ALL;
+	  damage_window(window);
 	}
 #endif /* CTK_CONF_MOUSE_SUPPORT */
     
@@ -1861,36 +2097,62 @@ PROCESS_THREAD(ctk_process, ev, data)
 	    if(window->x + window->w + 1 >= width) {
 	      --window->x;
 	    }
-	    redraw = REDRAW_ALL;
 	    break;
 	  case CH_CURS_LEFT:
 	    if(window->x > 0) {
 	      --window->x;
 	    }
-	    redraw = REDRAW_ALL;
 	    break;
 	  case CH_CURS_DOWN:
 	    ++window->y;
 	    if(window->y + window->h + 1 + CTK_CONF_MENUS >= height) {
 	      --window->y;
 	    }
-	    redraw = REDRAW_ALL;
 	    break;
 	  case CH_CURS_UP:
 	    if(window->y > 0) {
 	      --window->y;
 	    }
-	    redraw = REDRAW_ALL;
 	    break;
 	  default:
 	    mode = CTK_MODE_NORMAL;
-	    redraw = REDRAW_ALL;
+	    damage_window(window);
 	    break;
 	  }
 	}
+
+	/* Repaint both where the window was and where it is now, as one
+	   area since the two mostly overlap. */
+	if(window->x != moverect.x1 ||
+	   window->y + CTK_CONF_MENUS != moverect.y1) {
+	  struct ctk_rect r;
+
+	  window_rect(window, &r);
+	  if(r.x1 < moverect.x1) {
+	    moverect.x1 = r.x1;
+	  }
+	  if(r.y1 < moverect.y1) {
+	    moverect.y1 = r.y1;
+	  }
+	  if(r.x2 > moverect.x2) {
+	    moverect.x2 = r.x2;
+	  }
+	  if(r.y2 > moverect.y2) {
+	    moverect.y2 = r.y2;
+	  }
+	  add_damage(&moverect);
+	}
 #endif /* CTK_CONF_WINDOWMOVE */
       }
 
+#if CTK_CONF_WINDOWS
+    if((redraw & (REDRAW_ALL | REDRAW_DAMAGE)) == REDRAW_DAMAGE) {
+      do_redraw_damage();
+    }
+    if(redraw & (REDRAW_ALL | REDRAW_DAMAGE)) {
+      ndamage = 0;
+    }
+#endif /* CTK_CONF_WINDOWS */
     if(redraw & REDRAW_ALL) {
       do_redraw_all(CTK_CONF_MENUS, height);
 #if CTK_CONF_MENUS
@@ -665,6 +665,9 @@ struct ctk_desktop {
 #ifndef CTK_CONF_MAX_REDRAWWINDOWS
 #define CTK_CONF_MAX_REDRAWWINDOWS 8
 #endif /* CTK_CONF_MAX_REDRAWWINDOWS */
+#ifndef CTK_CONF_DAMAGE_RECTS
+#define CTK_CONF_DAMAGE_RECTS 4
+#endif /* CTK_CONF_DAMAGE_RECTS */
   
   unsigned char redraw; /**< The redraw flag. */
   
@@ -694,6 +697,20 @@ void ctk_mode_set(unsigned char mode);
 unsigned char ctk_mode_get(void);
 /*void ctk_redraw(void);*/
 
+#if CTK_CONF_STATISTICS
+/**
+ * The number of drawing calls the CTK has made to the ctk-draw
+ * back-end, to see how much of the screen a change repaints.
+ */
+struct ctk_stat {
+  unsigned short clears;  /**< Calls to ctk_draw_clear() and
+			     ctk_draw_clear_window(). */
+  unsigned short windows; /**< Calls to ctk_draw_window(). */
+  unsigned short widgets; /**< Calls to ctk_draw_widget(). */
+};
+extern struct ctk_stat ctk_stat;
+#endif /* CTK_CONF_STATISTICS */
+
 /* Functions for manipulating windows. */
 CCIF void ctk_window_new(struct ctk_window *window,
 			 unsigned char w, unsigned char h,
@@ -46,15 +46,90 @@
 #error Change SERIAL_LINE_CONF_BUFSIZE in contiki-conf.h.
 #endif
 
+/* With SERIAL_LINE_CONF_COALESCE, the interrupt handler only polls
+   the serial line process when a line is complete or when the ring
+   buffer has filled up to the watermark, instead of for every byte. */
+#ifdef SERIAL_LINE_CONF_COALESCE
+#define COALESCE SERIAL_LINE_CONF_COALESCE
+#else /* SERIAL_LINE_CONF_COALESCE */
+#define COALESCE 0
+#endif /* SERIAL_LINE_CONF_COALESCE */
+
+#ifdef SERIAL_LINE_CONF_WATERMARK
+#define WATERMARK SERIAL_LINE_CONF_WATERMARK
+#else /* SERIAL_LINE_CONF_WATERMARK */
+#define WATERMARK (BUFSIZE / 2)
+#endif /* SERIAL_LINE_CONF_WATERMARK */
+
+/* With SERIAL_LINE_CONF_BATCH, all complete lines that are available
+   are delivered in a single serial_line_event_batch event instead of
+   one serial_line_event_message per line. */
+#ifdef SERIAL_LINE_CONF_BATCH
+#define BATCH SERIAL_LINE_CONF_BATCH
+#else /* SERIAL_LINE_CONF_BATCH */
+#define BATCH 0
+#endif /* SERIAL_LINE_CONF_BATCH */
+
+/* With SERIAL_LINE_CONF_FLOW_CONTROL, XOFF is sent to the peer when
+   the ring buffer fills up to XOFF_LEVEL and XON when it has been
+   drained down to XON_LEVEL. Both are sent by the serial line
+   process: the input handler only flags that the buffer is filling
+   up. See serial_line_set_flow_control(). */
+#ifdef SERIAL_LINE_CONF_FLOW_CONTROL
+#define FLOW_CONTROL SERIAL_LINE_CONF_FLOW_CONTROL
+#else /* SERIAL_LINE_CONF_FLOW_CONTROL */
+#define FLOW_CONTROL 0
+#endif /* SERIAL_LINE_CONF_FLOW_CONTROL */
+
+#ifdef SERIAL_LINE_CONF_XOFF_LEVEL
+#define XOFF_LEVEL SERIAL_LINE_CONF_XOFF_LEVEL
+#else /* SERIAL_LINE_CONF_XOFF_LEVEL */
+#define XOFF_LEVEL (BUFSIZE - BUFSIZE / 4)
+#endif /* SERIAL_LINE_CONF_XOFF_LEVEL */
+
+#ifdef SERIAL_LINE_CONF_XON_LEVEL
+#define XON_LEVEL SERIAL_LINE_CONF_XON_LEVEL
+#else /* SERIAL_LINE_CONF_XON_LEVEL */
+#define XON_LEVEL (BUFSIZE / 4)
+#endif /* SERIAL_LINE_CONF_XON_LEVEL */
+
+#ifdef SERIAL_LINE_CONF_STATS
+#define STATS SERIAL_LINE_CONF_STATS
+#else /* SERIAL_LINE_CONF_STATS */
+#define STATS 0
+#endif /* SERIAL_LINE_CONF_STATS */
+
+#if STATS
+struct serial_line_stats serial_line_stats;
+#define STAT(s) s
+#else /* STATS */
+#define STAT(s)
+#endif /* STATS */
+
 #define IGNORE_CHAR(c) (c == 0x0d)
 #define END 0x0a
 
+#define XON  0x11
+#define XOFF 0x13
+
 static struct ringbuf rxbuf;
 static uint8_t rxbuf_data[BUFSIZE];
 
+#if FLOW_CONTROL
+static void (*flow_output)(unsigned char c);
+/* Set by the input handler when the buffer reaches XOFF_LEVEL,
+   cleared by the process once XON has been sent. */
+static volatile uint8_t stopped;
+/* Only used by the process. */
+static uint8_t xoff_sent;
+#endif /* FLOW_CONTROL */
+
 PROCESS(serial_line_process, "Serial driver");
 
 process_event_t serial_line_event_message;
+#if BATCH
+process_event_t serial_line_event_batch;
+#endif /* BATCH */
 
 /*---------------------------------------------------------------------------*/
 int
@@ -71,64 +146,164 @@ serial_line_input_byte(unsigned char c)
     if(ringbuf_put(&rxbuf, c) == 0) {
       /* Buffer overflow: ignore the rest of the line */
       overflow = 1;
+      STAT(serial_line_stats.overflows++);
+      STAT(serial_line_stats.dropped_bytes++);
     }
   } else {
     /* Buffer overflowed:
      * Only (try to) add terminator characters, otherwise skip */
     if(c == END && ringbuf_put(&rxbuf, c) != 0) {
       overflow = 0;
+    } else {
+      STAT(serial_line_stats.dropped_bytes++);
     }
   }
 
+#if FLOW_CONTROL
+  if(!stopped && flow_output != NULL &&
+     ringbuf_elements(&rxbuf) >= XOFF_LEVEL) {
+    /* The process sends XOFF as soon as it runs. */
+    stopped = 1;
+    process_poll(&serial_line_process);
+    return 1;
+  }
+#endif /* FLOW_CONTROL */
+
+#if COALESCE
+  /* Only wake up the consumer process if it has something to deliver
+     or if the buffer needs to be drained. */
+  if(c != END && !overflow && ringbuf_elements(&rxbuf) < WATERMARK) {
+    return 0;
+  }
+#endif /* COALESCE */
+
   /* Wake up consumer process */
   process_poll(&serial_line_process);
   return 1;
 }
 /*---------------------------------------------------------------------------*/
+#if FLOW_CONTROL
+static void
+flow_update(void)
+{
+  if(flow_output == NULL) {
+    return;
+  }
+  if(stopped && !xoff_sent) {
+    xoff_sent = 1;
+    flow_output(XOFF);
+    STAT(serial_line_stats.xoffs++);
+  }
+  if(xoff_sent && ringbuf_elements(&rxbuf) <= XON_LEVEL) {
+    xoff_sent = 0;
+    flow_output(XON);
+    /* The input handler may flag the buffer again from here on. */
+    stopped = 0;
+  }
+}
+#else /* FLOW_CONTROL */
+#define flow_update()
+#endif /* FLOW_CONTROL */
+/*---------------------------------------------------------------------------*/
 PROCESS_THREAD(serial_line_process, ev, data)
 {
   static char buf[BUFSIZE];
   static int ptr;
+  static int c;
+  /* Number of bytes and lines in buf that are complete lines */
+  static int done;
+  static uint8_t lines;
+  static uint8_t truncated;
+#if BATCH
+  static struct serial_line_batch batch;
+#endif /* BATCH */
 
   PROCESS_BEGIN();
 
   serial_line_event_message = process_alloc_event();
-  ptr = 0;
+#if BATCH
+  serial_line_event_batch = process_alloc_event();
+#endif /* BATCH */
+  ptr = done = lines = truncated = 0;
 
   while(1) {
     /* Fill application buffer until newline or empty */
-    int c = ringbuf_get(&rxbuf);
-    
-    if(c == -1) {
-      /* Buffer empty, wait for poll */
-      PROCESS_YIELD();
-    } else {
-      if(c != END) {
-        if(ptr < BUFSIZE-1) {
-          buf[ptr++] = (uint8_t)c;
-        } else {
-          /* Ignore character (wait for EOL) */
-        }
+    c = ringbuf_get(&rxbuf);
+    flow_update();
+
+    if(c == END) {
+      /* Terminate */
+      buf[ptr++] = (uint8_t)'\0';
+      done = ptr;
+      lines++;
+      truncated = 0;
+    } else if(c != -1) {
+      if(ptr < BUFSIZE - 1) {
+        buf[ptr++] = (uint8_t)c;
       } else {
-        /* Terminate */
-        buf[ptr++] = (uint8_t)'\0';
+        /* Ignore character (wait for EOL) */
+        if(!truncated) {
+          truncated = 1;
+          STAT(serial_line_stats.truncated_lines++);
+        }
+      }
+    }
 
-        /* Broadcast event */
-        process_post(PROCESS_BROADCAST, serial_line_event_message, buf);
+    /* Deliver each line as soon as it is complete or, in batch mode,
+       all complete lines once the input has been drained or the
+       application buffer has filled up. */
+    if(done > 0 && (!BATCH || c == -1 || ptr >= BUFSIZE - 1)) {
+#if BATCH
+      batch.data = buf;
+      batch.len = done;
+      batch.lines = lines;
+      process_post(PROCESS_BROADCAST, serial_line_event_batch, &batch);
+#else /* BATCH */
+      /* Broadcast event */
+      process_post(PROCESS_BROADCAST, serial_line_event_message, buf);
+#endif /* BATCH */
 
-        /* Wait until all processes have handled the serial line event */
-        if(PROCESS_ERR_OK ==
-          process_post(PROCESS_CURRENT(), PROCESS_EVENT_CONTINUE, NULL)) {
-          PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_CONTINUE);
-        }
-        ptr = 0;
+      /* Wait until all processes have handled the serial line event */
+      if(PROCESS_ERR_OK ==
+        process_post(PROCESS_CURRENT(), PROCESS_EVENT_CONTINUE, NULL)) {
+        PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_CONTINUE);
       }
+
+      /* Keep the partial line that follows the delivered lines */
+      memmove(buf, buf + done, ptr - done);
+      ptr -= done;
+      done = 0;
+      lines = 0;
+    } else if(c == -1) {
+      /* Buffer empty, wait for poll */
+      PROCESS_YIELD();
     }
   }
 
   PROCESS_END();
 }
 /*---------------------------------------------------------------------------*/
+#if BATCH
+const char *
+serial_line_batch_next(const struct serial_line_batch *batch,
+                       const char *line)
+{
+  if(line == NULL) {
+    return batch->lines > 0 ? batch->data : NULL;
+  }
+  line += strlen(line) + 1;
+  return line < batch->data + batch->len ? line : NULL;
+}
+#endif /* BATCH */
+/*---------------------------------------------------------------------------*/
+#if FLOW_CONTROL
+void
+serial_line_set_flow_control(void (*output)(unsigned char c))
+{
+  flow_output = output;
+}
+#endif /* FLOW_CONTROL */
+/*---------------------------------------------------------------------------*/
 void
 serial_line_init(void)
 {
@@ -72,6 +72,68 @@ int serial_line_input_byte(unsigned char c);
 
 void serial_line_init(void);
 
+/**
+ * A batch of input lines, posted with serial_line_event_batch.
+ *
+ * The lines are stored back to back in data, each one terminated by
+ * a '\0'. Use serial_line_batch_next() to iterate over them.
+ */
+struct serial_line_batch {
+  char *data;
+  uint16_t len;
+  uint8_t lines;
+};
+
+/**
+ * Event posted when one or more lines of input have been received
+ * and SERIAL_LINE_CONF_BATCH is enabled.
+ *
+ * In batch mode this event replaces serial_line_event_message. The
+ * data pointer points to a struct serial_line_batch that is valid
+ * until the event has been handled.
+ */
+extern process_event_t serial_line_event_batch;
+
+/**
+ * Get the next line of a batch.
+ *
+ * \param batch The batch received with serial_line_event_batch.
+ * \param line The previous line, or NULL to get the first line.
+ *
+ * \return The next line, or NULL if there are no more lines.
+ */
+const char *serial_line_batch_next(const struct serial_line_batch *batch,
+                                   const char *line);
+
+/**
+ * Set the function used to send XON/XOFF to the peer.
+ *
+ * With SERIAL_LINE_CONF_FLOW_CONTROL enabled, the serial driver
+ * sends XOFF when its input buffer is about to overflow and XON
+ * when it has been drained. Both are sent from the serial line
+ * process, never from serial_line_input_byte(), so the function does
+ * not have to be safe to call from the UART interrupt handler. XOFF
+ * is sent as soon as the process runs after the buffer has filled
+ * up to the XOFF level, so that level must leave room for the bytes
+ * that arrive in the meantime.
+ *
+ * \param output The function that writes one byte to the UART.
+ */
+void serial_line_set_flow_control(void (*output)(unsigned char c));
+
+/**
+ * Serial line input statistics, kept if SERIAL_LINE_CONF_STATS is
+ * enabled.
+ */
+struct serial_line_stats {
+  uint16_t overflows;       /**< Lines cut short by a full input buffer. */
+  uint16_t dropped_bytes;   /**< Bytes dropped because of a full input buffer. */
+  uint16_t truncated_lines; /**< Lines longer than the line buffer. */
+  uint16_t xoffs;           /**< Number of times XOFF was sent. */
+};
+
+extern struct serial_line_stats serial_line_stats;
+
 PROCESS_NAME(serial_line_process);
 
 #endif /* __SERIAL_LINE_H__ */
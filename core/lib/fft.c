@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Fixed-point FFT
+ */
+
+#include "lib/fft.h"
+
+/* sin(2 * pi * i / FFT_MAX_SIZE) in Q15, for the first quarter
+   period. The other twiddle factors are found by symmetry. */
+#define QUARTER (FFT_MAX_SIZE / 4)
+
+static const int16_t sin_tab[QUARTER + 1] = {
+  0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809,
+  2009, 2210, 2411, 2611, 2811, 3012, 3212, 3412, 3612, 3812,
+  4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800,
+  5998, 6195, 6393, 6590, 6787, 6983, 7180, 7376, 7571, 7767,
+  7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319, 9512, 9704,
+  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463,
+  13646, 13828, 14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+  15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846, 17018,
+  17190, 17361, 17531, 17700, 17869, 18037, 18205, 18372, 18538, 18703,
+  18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001, 20160, 20318,
+  20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+  22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312,
+  23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680,
+  24812, 24943, 25073, 25202, 25330, 25457, 25583, 25708, 25833, 25956,
+  26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+  27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209,
+  28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+  29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038,
+  30118, 30196, 30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784,
+  30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298, 31357, 31415,
+  31471, 31527, 31581, 31634, 31686, 31737, 31786, 31834, 31881, 31927,
+  31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251, 32286, 32319,
+  32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+  32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738,
+  32746, 32753, 32758, 32762, 32766, 32767, 32767
+};
+
+/* Bit reversal of a nibble. */
+static const uint8_t rev4[16] = {
+  0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+  0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf
+};
+
+/* Scaling limits: the largest magnitude of a component that cannot
+   overflow in a radix-2 or a radix-4 butterfly. */
+#define RADIX2_LIMIT 8192
+#define RADIX4_LIMIT 4096
+
+#define MUL(a, b) ((int16_t)(((int32_t)(a) * (b)) >> 15))
+
+/*---------------------------------------------------------------------------*/
+/* The twiddle factor exp(-2 * pi * i * t / FFT_MAX_SIZE). */
+static void
+twiddle(uint16_t t, int16_t *wr, int16_t *wi)
+{
+  uint16_t r = t & (QUARTER - 1);
+
+  switch(t / QUARTER) {
+  case 0:
+    *wr = sin_tab[QUARTER - r];
+    *wi = -sin_tab[r];
+    break;
+  case 1:
+    *wr = -sin_tab[r];
+    *wi = -sin_tab[QUARTER - r];
+    break;
+  case 2:
+    *wr = -sin_tab[QUARTER - r];
+    *wi = sin_tab[r];
+    break;
+  default:
+    *wr = sin_tab[r];
+    *wi = sin_tab[QUARTER - r];
+    break;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static uint16_t
+bitrev(uint16_t j, uint8_t bits)
+{
+  return (((uint16_t)rev4[j & 0xf] << 12) |
+          ((uint16_t)rev4[(j >> 4) & 0xf] << 8) |
+          ((uint16_t)rev4[(j >> 8) & 0xf] << 4) |
+          rev4[j >> 12]) >> (16 - bits);
+}
+/*---------------------------------------------------------------------------*/
+static uint8_t
+log2n(uint16_t n)
+{
+  uint8_t bits;
+
+  for(bits = 0; (1U << bits) < n; bits++);
+  return bits;
+}
+/*---------------------------------------------------------------------------*/
+/* Shift the block down so that no component is limit or larger, and
+   return the number of bits shifted. */
+static uint8_t
+scale(int16_t x[], uint16_t len, uint16_t limit)
+{
+  uint16_t i, max, v;
+  uint8_t shift;
+
+  max = 0;
+  for(i = 0; i < len; i++) {
+    v = x[i] < 0 ? -(int32_t)x[i] : x[i];
+    if(v > max) {
+      max = v;
+    }
+  }
+  for(shift = 0; max >= limit; shift++) {
+    max >>= 1;
+  }
+  if(shift > 0) {
+    for(i = 0; i < len; i++) {
+      x[i] >>= shift;
+    }
+  }
+  return shift;
+}
+/*---------------------------------------------------------------------------*/
+int
+fft_complex(int16_t x[], uint16_t n)
+{
+  uint16_t i, j, k, m, stride;
+  uint8_t bits;
+  int exponent;
+  int16_t t;
+  int16_t w1r, w1i, w2r, w2i, w3r, w3i;
+  int16_t ar, ai, br, bi, cr, ci, dr, di;
+  int16_t t1r, t1i, t2r, t2i, t3r, t3i;
+  int16_t *x0, *x1, *x2, *x3;
+
+  bits = log2n(n);
+  if(n == 0 || n > FFT_MAX_SIZE || (1U << bits) != n) {
+    return -1;
+  }
+
+  /* Reorder the input so that the butterflies can work in place. */
+  for(i = 0; i < n; i++) {
+    j = bitrev(i, bits);
+    if(j > i) {
+      t = x[2 * i];
+      x[2 * i] = x[2 * j];
+      x[2 * j] = t;
+      t = x[2 * i + 1];
+      x[2 * i + 1] = x[2 * j + 1];
+      x[2 * j + 1] = t;
+    }
+  }
+
+  exponent = 0;
+  m = 1;
+
+  /* With an odd number of stages, start with a radix-2 stage. All its
+     twiddle factors are one. */
+  if(bits & 1) {
+    exponent += scale(x, 2 * n, RADIX2_LIMIT);
+    for(k = 0; k < n; k += 2) {
+      x0 = &x[2 * k];
+      x1 = &x[2 * k + 2];
+      ar = x0[0];
+      ai = x0[1];
+      x0[0] = ar + x1[0];
+      x0[1] = ai + x1[1];
+      x1[0] = ar - x1[0];
+      x1[1] = ai - x1[1];
+    }
+    m = 2;
+  }
+
+  /* Each radix-4 stage does the work of two radix-2 stages, with
+     spans m and 2m, using three complex multiplications per four
+     points instead of four. */
+  for(; m < n; m *= 4) {
+    exponent += scale(x, 2 * n, RADIX4_LIMIT);
+    stride = FFT_MAX_SIZE / (4 * m);
+    for(j = 0; j < m; j++) {
+      twiddle(2 * j * stride, &w1r, &w1i);
+      twiddle(j * stride, &w2r, &w2i);
+      twiddle(3 * j * stride, &w3r, &w3i);
+      for(k = j; k < n; k += 4 * m) {
+        x0 = &x[2 * k];
+        x1 = &x[2 * (k + m)];
+        x2 = &x[2 * (k + 2 * m)];
+        x3 = &x[2 * (k + 3 * m)];
+
+        t1r = MUL(x1[0], w1r) - MUL(x1[1], w1i);
+        t1i = MUL(x1[0], w1i) + MUL(x1[1], w1r);
+        t2r = MUL(x2[0], w2r) - MUL(x2[1], w2i);
+        t2i = MUL(x2[0], w2i) + MUL(x2[1], w2r);
+        t3r = MUL(x3[0], w3r) - MUL(x3[1], w3i);
+        t3i = MUL(x3[0], w3i) + MUL(x3[1], w3r);
+
+        ar = x0[0] + t1r;
+        ai = x0[1] + t1i;
+        br = x0[0] - t1r;
+        bi = x0[1] - t1i;
+        cr = t2r + t3r;
+        ci = t2i + t3i;
+        dr = t2r - t3r;
+        di = t2i - t3i;
+
+        /* Multiplying d by -i swaps its parts. */
+        x0[0] = ar + cr;
+        x0[1] = ai + ci;
+        x2[0] = ar - cr;
+        x2[1] = ai - ci;
+        x1[0] = br + di;
+        x1[1] = bi - dr;
+        x3[0] = br - di;
+        x3[1] = bi + dr;
+      }
+    }
+  }
+
+  return exponent;
+}
+/*---------------------------------------------------------------------------*/
+int
+fft_real(int16_t x[], uint16_t n)
+{
+  uint16_t k, half, stride;
+  int exponent;
+  int16_t wr, wi;
+  int16_t er, ei, odr, odi, tr, ti;
+  int16_t *a, *b;
+
+  if(n < 4 || n > FFT_MAX_SIZE) {
+    return -1;
+  }
+
+  /* Treat the even and odd samples as the real and imaginary parts
+     of a complex sequence of half the length. */
+  half = n / 2;
+  exponent = fft_complex(x, half);
+  if(exponent < 0) {
+    return -1;
+  }
+  exponent += scale(x, n, RADIX2_LIMIT);
+
+  /* Split the result into the spectrum of the real input. Bins k and
+     half - k are computed from the same two complex values. */
+  er = x[0];
+  ei = x[1];
+  x[0] = er + ei;
+  x[1] = er - ei;
+
+  stride = FFT_MAX_SIZE / n;
+  for(k = 1; k <= half / 2; k++) {
+    a = &x[2 * k];
+    b = &x[2 * (half - k)];
+
+    /* e = (a + conj(b)) / 2, o = -i (a - conj(b)) / 2 */
+    er = (a[0] + b[0]) >> 1;
+    ei = (a[1] - b[1]) >> 1;
+    odr = (a[1] + b[1]) >> 1;
+    odi = (b[0] - a[0]) >> 1;
+
+    twiddle(k * stride, &wr, &wi);
+    tr = MUL(odr, wr) - MUL(odi, wi);
+    ti = MUL(odr, wi) + MUL(odi, wr);
+
+    /* X[k] = e + w o, X[half - k] = conj(e - w o) */
+    a[0] = er + tr;
+    a[1] = ei + ti;
+    b[0] = er - tr;
+    b[1] = ti - ei;
+  }
+
+  return exponent;
+}
+/*---------------------------------------------------------------------------*/
+void
+fft_magnitude(int16_t x[], uint16_t n)
+{
+  uint16_t k, re, im, max, min;
+  uint32_t mag;
+
+  for(k = 0; k < n; k++) {
+    re = x[2 * k] < 0 ? -(int32_t)x[2 * k] : x[2 * k];
+    im = x[2 * k + 1] < 0 ? -(int32_t)x[2 * k + 1] : x[2 * k + 1];
+    if(re > im) {
+      max = re;
+      min = im;
+    } else {
+      max = im;
+      min = re;
+    }
+    /* Alpha max plus beta min, with alpha = 31/32 and beta = 13/32. */
+    mag = ((uint32_t)max * 31 + (uint32_t)min * 13) >> 5;
+    x[k] = mag > 0x7fff ? 0x7fff : mag;
+  }
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Fixed-point FFT
+ *
+ *         A table-driven, in-place, radix-4 FFT on Q15 samples with
+ *         block floating-point scaling. Complex data is interleaved,
+ *         i.e., x[2k] is the real part and x[2k + 1] the imaginary
+ *         part of element k.
+ *
+ *         Instead of overflowing, the transforms scale the data down
+ *         by powers of two as needed and return the total number of
+ *         bits shifted out. The true transform is the result
+ *         multiplied by 2 to the power of the returned exponent.
+ */
+
+#ifndef __FFT_H__
+#define __FFT_H__
+
+#include "contiki-conf.h"
+
+/** The largest transform size supported by the twiddle table. */
+#define FFT_MAX_SIZE 1024
+
+/**
+ * \brief      Compute the FFT of complex data in place
+ * \param x    Interleaved complex data, 2 * n values
+ * \param n    The number of complex points, a power of two no
+ *             larger than FFT_MAX_SIZE
+ * \return     The block exponent of the result, or -1 if n is
+ *             not a supported size
+ */
+int fft_complex(int16_t x[], uint16_t n);
+
+/**
+ * \brief      Compute the FFT of real data in place
+ * \param x    The real samples, n values
+ * \param n    The number of samples, a power of two between 4
+ *             and FFT_MAX_SIZE
+ * \return     The block exponent of the result, or -1 if n is
+ *             not a supported size
+ *
+ *             Runs an n/2 point complex FFT and splits the
+ *             result, which takes about half the time of a complex
+ *             FFT of the same size. On return x holds the
+ *             non-redundant half of the spectrum: x[0] is the real DC
+ *             term, x[1] is the real term at n/2 and x[2k], x[2k + 1]
+ *             is the complex term k, for 0 < k < n/2.
+ */
+int fft_real(int16_t x[], uint16_t n);
+
+/**
+ * \brief      Approximate the magnitudes of complex values in place
+ * \param x    Interleaved complex data, 2 * n values
+ * \param n    The number of complex values
+ *
+ *             On return x[k] holds the magnitude of element k, within
+ *             a few percent. Note that for the output of fft_real()
+ *             x[0] is the combined DC and n/2 term.
+ */
+void fft_magnitude(int16_t x[], uint16_t n);
+
+#endif /* __FFT_H__ */
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Periodic sensor sampling with windowed aggregation
+ */
+
+#include "lib/sensor-pipeline.h"
+
+#define FLAG_TRIGGER   0x01
+#define FLAG_TRIGGERED 0x02
+
+/*---------------------------------------------------------------------------*/
+int16_t
+sensor_pipeline_sample(struct sensor_pipeline *p, uint8_t count, uint8_t i)
+{
+  return p->buf[(uint8_t)(p->put - count + i) & p->mask];
+}
+/*---------------------------------------------------------------------------*/
+static void
+close_window(struct sensor_pipeline *p, uint8_t reason)
+{
+  struct sensor_pipeline_report r;
+  int32_t sum, d;
+  uint32_t sq, var;
+  int16_t v;
+  uint8_t i;
+
+  if(p->count == 0) {
+    return;
+  }
+
+  r.pipeline = p;
+  r.reason = reason;
+  r.count = p->count;
+  r.min = r.max = sensor_pipeline_sample(p, p->count, 0);
+  sum = 0;
+  for(i = 0; i < p->count; i++) {
+    v = sensor_pipeline_sample(p, p->count, i);
+    sum += v;
+    if(v < r.min) {
+      r.min = v;
+    }
+    if(v > r.max) {
+      r.max = v;
+    }
+  }
+  r.mean = sum / p->count;
+  r.last = v;
+
+  /* A second pass avoids the overflow and cancellation of a sum of
+     squares. The variance saturates for very noisy signals. */
+  var = 0;
+  for(i = 0; i < p->count; i++) {
+    d = (int32_t)sensor_pipeline_sample(p, p->count, i) - r.mean;
+    if(d < 0) {
+      d = -d;
+    }
+    sq = (uint32_t)d * (uint32_t)d;
+    if(var > 0xffffffffUL - sq) {
+      var = 0xffffffffUL;
+      break;
+    }
+    var += sq;
+  }
+  r.variance = var == 0xffffffffUL ? var : var / p->count;
+
+  p->count = 0;
+  if(p->report != NULL) {
+    p->report(&r);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+sample(void *ptr)
+{
+  struct sensor_pipeline *p = ptr;
+  int16_t v;
+
+  ctimer_reset(&p->timer);
+
+  v = p->sensor->value(p->type);
+  p->buf[p->put & p->mask] = v;
+  p->put++;
+  p->count++;
+
+  if(p->flags & FLAG_TRIGGER) {
+    if(v < p->trigger_low || v > p->trigger_high) {
+      if(!(p->flags & FLAG_TRIGGERED)) {
+        p->flags |= FLAG_TRIGGERED;
+        close_window(p, SENSOR_PIPELINE_TRIGGER);
+        return;
+      }
+    } else {
+      p->flags &= ~FLAG_TRIGGERED;
+    }
+  }
+
+  if(p->count >= p->window) {
+    close_window(p, SENSOR_PIPELINE_WINDOW);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+sensor_pipeline_open(struct sensor_pipeline *p,
+                     const struct sensors_sensor *sensor, int type,
+                     clock_time_t interval,
+                     int16_t *buf, uint8_t size, uint8_t window,
+                     void (* report)(const struct sensor_pipeline_report *r))
+{
+  p->sensor = sensor;
+  p->type = type;
+  p->report = report;
+  p->buf = buf;
+  p->mask = size - 1;
+  p->put = 0;
+  p->window = window > size ? size : window;
+  p->count = 0;
+  p->flags = 0;
+  ctimer_set(&p->timer, interval, sample, p);
+}
+/*---------------------------------------------------------------------------*/
+void
+sensor_pipeline_close(struct sensor_pipeline *p)
+{
+  ctimer_stop(&p->timer);
+}
+/*---------------------------------------------------------------------------*/
+void
+sensor_pipeline_set_trigger(struct sensor_pipeline *p,
+                            int16_t low, int16_t high)
+{
+  p->trigger_low = low;
+  p->trigger_high = high;
+  p->flags = FLAG_TRIGGER;
+}
+/*---------------------------------------------------------------------------*/
+void
+sensor_pipeline_clear_trigger(struct sensor_pipeline *p)
+{
+  p->flags = 0;
+}
+/*---------------------------------------------------------------------------*/
+static int
+put_varint(uint8_t *out, int len, int pos, uint16_t v)
+{
+  do {
+    if(pos >= len) {
+      return -1;
+    }
+    out[pos++] = (v & 0x7f) | (v > 0x7f ? 0x80 : 0);
+    v >>= 7;
+  } while(v != 0);
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+int
+sensor_pipeline_delta_encode(struct sensor_pipeline *p, uint8_t count,
+                             uint8_t *out, int len)
+{
+  int16_t prev, v, d;
+  uint8_t i;
+  int pos;
+
+  pos = 0;
+  prev = 0;
+  for(i = 0; i < count; i++) {
+    v = sensor_pipeline_sample(p, count, i);
+    d = v - prev;
+    prev = v;
+    /* Zigzag encoding maps small negative numbers to small positive
+       ones: 0, -1, 1, -2, ... become 0, 1, 2, 3, ... */
+    pos = put_varint(out, len, pos, ((uint16_t)d << 1) ^ (uint16_t)(d >> 15));
+    if(pos < 0) {
+      return 0;
+    }
+  }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
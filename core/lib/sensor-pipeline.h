@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Periodic sensor sampling with windowed aggregation
+ *
+ *         A sensor pipeline samples one sensor at a fixed rate into
+ *         a ring buffer and summarizes the samples of each window
+ *         (minimum, maximum, mean and variance). The application is
+ *         only called when a window closes or when a sample crosses
+ *         a trigger threshold, instead of for every sample. The
+ *         samples of the last window can be delta encoded for
+ *         compact transmission.
+ *
+ *         Sampling is driven by a ctimer, as the rtimer is used by
+ *         the radio duty cycling layer. The sensor's value()
+ *         function is therefore called from a process context and
+ *         does not need to be interrupt safe.
+ */
+
+#ifndef __SENSOR_PIPELINE_H__
+#define __SENSOR_PIPELINE_H__
+
+#include "contiki.h"
+#include "lib/sensors.h"
+
+/** The window was full. */
+#define SENSOR_PIPELINE_WINDOW  0
+/** A sample crossed a trigger threshold. */
+#define SENSOR_PIPELINE_TRIGGER 1
+
+struct sensor_pipeline;
+
+struct sensor_pipeline_report {
+  struct sensor_pipeline *pipeline;
+  uint8_t reason;
+  uint8_t count;
+  int16_t min, max, mean, last;
+  uint32_t variance;
+};
+
+struct sensor_pipeline {
+  const struct sensors_sensor *sensor;
+  int type;
+  struct ctimer timer;
+  void (* report)(const struct sensor_pipeline_report *r);
+  int16_t *buf;
+  uint8_t mask;
+  uint8_t put;
+  uint8_t window;
+  uint8_t count;
+  uint8_t flags;
+  int16_t trigger_low, trigger_high;
+};
+
+/**
+ * \brief      Start sampling a sensor
+ * \param p    A pointer to a struct sensor_pipeline
+ * \param sensor The sensor to sample
+ * \param type The argument given to the sensor's value() function
+ * \param interval The time between samples
+ * \param buf  A buffer for the samples
+ * \param size The number of samples in buf, a power of two no
+ *             larger than 128
+ * \param window The number of samples in a window, at most size
+ * \param report The function that is called when a window closes
+ */
+void sensor_pipeline_open(struct sensor_pipeline *p,
+                          const struct sensors_sensor *sensor, int type,
+                          clock_time_t interval,
+                          int16_t *buf, uint8_t size, uint8_t window,
+                          void (* report)(const struct sensor_pipeline_report *r));
+
+/**
+ * \brief      Stop sampling
+ * \param p    A pointer to an open struct sensor_pipeline
+ */
+void sensor_pipeline_close(struct sensor_pipeline *p);
+
+/**
+ * \brief      Report early when a sample leaves a range
+ * \param p    A pointer to an open struct sensor_pipeline
+ * \param low  The lower threshold
+ * \param high The upper threshold
+ *
+ *             A report with reason SENSOR_PIPELINE_TRIGGER is made,
+ *             and a new window started, when a sample falls below low
+ *             or rises above high. Only the crossing triggers a
+ *             report; the samples must return within the range
+ *             before the trigger can fire again.
+ */
+void sensor_pipeline_set_trigger(struct sensor_pipeline *p,
+                                 int16_t low, int16_t high);
+
+/**
+ * \brief      Disable the trigger thresholds
+ * \param p    A pointer to an open struct sensor_pipeline
+ */
+void sensor_pipeline_clear_trigger(struct sensor_pipeline *p);
+
+/**
+ * \brief      Get a sample from the last window
+ * \param p    A pointer to a struct sensor_pipeline
+ * \param count The number of samples in the window, from the report
+ * \param i    The sample index, where 0 is the oldest sample
+ *
+ *             Valid in the report callback, and afterwards until it
+ *             is overwritten by new samples.
+ */
+int16_t sensor_pipeline_sample(struct sensor_pipeline *p, uint8_t count,
+                               uint8_t i);
+
+/**
+ * \brief      Delta encode the samples of the last window
+ * \param p    A pointer to a struct sensor_pipeline
+ * \param count The number of samples in the window, from the report
+ * \param out  The output buffer
+ * \param len  The size of the output buffer
+ * \return     The number of bytes written, or 0 if the buffer is
+ *             too small
+ *
+ *             The first sample is followed by the difference between
+ *             each sample and the one before it. Each value is zigzag
+ *             encoded and written as a varint of 7 bits per byte, so
+ *             slowly changing signals take one byte per sample.
+ */
+int sensor_pipeline_delta_encode(struct sensor_pipeline *p, uint8_t count,
+                                 uint8_t *out, int len);
+
+#endif /* __SENSOR_PIPELINE_H__ */
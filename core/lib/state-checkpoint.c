@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Persistent snapshots of run-time state tables
+ */
+
+#include "lib/state-checkpoint.h"
+#include "lib/crc16.h"
+#include "lib/list.h"
+#include "cfs/cfs.h"
+#if STATE_CHECKPOINT_CONF_WITH_COFFEE
+#include "cfs/cfs-coffee.h"
+#endif /* STATE_CHECKPOINT_CONF_WITH_COFFEE */
+
+#include <string.h>
+
+#ifdef STATE_CHECKPOINT_CONF_INTERVAL
+#define STATE_CHECKPOINT_INTERVAL STATE_CHECKPOINT_CONF_INTERVAL
+#else /* STATE_CHECKPOINT_CONF_INTERVAL */
+#define STATE_CHECKPOINT_INTERVAL 600
+#endif /* STATE_CHECKPOINT_CONF_INTERVAL */
+
+#ifdef STATE_CHECKPOINT_CONF_MAX_BOOTS
+#define STATE_CHECKPOINT_MAX_BOOTS STATE_CHECKPOINT_CONF_MAX_BOOTS
+#else /* STATE_CHECKPOINT_CONF_MAX_BOOTS */
+#define STATE_CHECKPOINT_MAX_BOOTS 1
+#endif /* STATE_CHECKPOINT_CONF_MAX_BOOTS */
+
+#ifdef STATE_CHECKPOINT_CONF_MAX_AGE
+#define STATE_CHECKPOINT_MAX_AGE STATE_CHECKPOINT_CONF_MAX_AGE
+#else /* STATE_CHECKPOINT_CONF_MAX_AGE */
+#define STATE_CHECKPOINT_MAX_AGE 3600
+#endif /* STATE_CHECKPOINT_CONF_MAX_AGE */
+
+#ifdef STATE_CHECKPOINT_CONF_MAX_RECORD_SIZE
+#define STATE_CHECKPOINT_MAX_RECORD_SIZE STATE_CHECKPOINT_CONF_MAX_RECORD_SIZE
+#else /* STATE_CHECKPOINT_CONF_MAX_RECORD_SIZE */
+#define STATE_CHECKPOINT_MAX_RECORD_SIZE 16
+#endif /* STATE_CHECKPOINT_CONF_MAX_RECORD_SIZE */
+
+#ifdef STATE_CHECKPOINT_CONF_TIME
+#define STATE_CHECKPOINT_TIME() STATE_CHECKPOINT_CONF_TIME()
+#else /* STATE_CHECKPOINT_CONF_TIME */
+#define STATE_CHECKPOINT_TIME() 0
+#endif /* STATE_CHECKPOINT_CONF_TIME */
+
+#define BOOT_COUNTER_FILE "ckboot"
+
+/* The rate limit is enforced with a coarse tick so that long
+   intervals do not overflow a 16-bit clock_time_t. */
+#define TICK_SECONDS 30
+
+#define VERSION 1
+
+struct header {
+  uint8_t version;
+  uint8_t record_size;
+  uint8_t num;
+  uint8_t seqno;
+  uint16_t boot;
+  uint16_t crc;
+  uint32_t time;
+};
+
+LIST(checkpoints);
+
+static uint16_t boot_count;
+static uint8_t initialized;
+
+PROCESS(state_checkpoint_process, "State checkpoint");
+
+#define DEBUG 0
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+/*---------------------------------------------------------------------------*/
+static void
+init(void)
+{
+  int fd;
+
+  if(initialized) {
+    return;
+  }
+  initialized = 1;
+  list_init(checkpoints);
+
+  boot_count = 0;
+  fd = cfs_open(BOOT_COUNTER_FILE, CFS_READ);
+  if(fd >= 0) {
+    if(cfs_read(fd, &boot_count, sizeof(boot_count)) != sizeof(boot_count)) {
+      boot_count = 0;
+    }
+    cfs_close(fd);
+  }
+  boot_count++;
+  fd = cfs_open(BOOT_COUNTER_FILE, CFS_WRITE);
+  if(fd >= 0) {
+    cfs_write(fd, &boot_count, sizeof(boot_count));
+    cfs_close(fd);
+  }
+  PRINTF("state-checkpoint: boot %u\n", boot_count);
+
+  process_start(&state_checkpoint_process, NULL);
+}
+/*---------------------------------------------------------------------------*/
+static int
+valid(struct state_checkpoint *c, const struct header *h)
+{
+  uint16_t boots;
+
+  if(h->version != VERSION || h->record_size != c->record_size ||
+     h->num > c->max_records) {
+    return 0;
+  }
+  boots = boot_count - h->boot;
+  if(boots == 0 || boots > STATE_CHECKPOINT_MAX_BOOTS) {
+    PRINTF("state-checkpoint: %s written %u boots ago\n", c->name, boots);
+    return 0;
+  }
+#ifdef STATE_CHECKPOINT_CONF_TIME
+  if((uint32_t)(STATE_CHECKPOINT_TIME() - h->time) > STATE_CHECKPOINT_MAX_AGE) {
+    PRINTF("state-checkpoint: %s too old\n", c->name);
+    return 0;
+  }
+#endif /* STATE_CHECKPOINT_CONF_TIME */
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Each table alternates between two snapshot files, so that a write
+ * that is interrupted by a reboot never destroys the last good
+ * snapshot.
+ */
+static void
+filename(struct state_checkpoint *c, uint8_t file, char *name)
+{
+  int len;
+
+  len = strlen(c->name);
+  memcpy(name, c->name, len);
+  name[len] = '0' + file;
+  name[len + 1] = 0;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Open a snapshot file and check its header and checksum. On success,
+ * the file is left open with the read position at the first record.
+ */
+static int
+open_snapshot(struct state_checkpoint *c, uint8_t file, struct header *h)
+{
+  char name[STATE_CHECKPOINT_NAME_LEN + 1];
+  uint8_t record[STATE_CHECKPOINT_MAX_RECORD_SIZE];
+  uint16_t crc;
+  int fd;
+  int i;
+
+  filename(c, file, name);
+  fd = cfs_open(name, CFS_READ);
+  if(fd < 0) {
+    return -1;
+  }
+  if(cfs_read(fd, h, sizeof(*h)) != sizeof(*h) || !valid(c, h)) {
+    cfs_close(fd);
+    return -1;
+  }
+
+  crc = 0;
+  for(i = 0; i < h->num; i++) {
+    if(cfs_read(fd, record, c->record_size) != c->record_size) {
+      cfs_close(fd);
+      return -1;
+    }
+    crc = crc16_data(record, c->record_size, crc);
+  }
+  crc = crc16_add(h->num, crc);
+  if(crc != h->crc) {
+    PRINTF("state-checkpoint: %s bad checksum\n", name);
+    cfs_close(fd);
+    return -1;
+  }
+
+  cfs_seek(fd, sizeof(*h), CFS_SEEK_SET);
+  return fd;
+}
+/*---------------------------------------------------------------------------*/
+static void
+restore(struct state_checkpoint *c)
+{
+  struct header h0, h1, *h;
+  uint8_t record[STATE_CHECKPOINT_MAX_RECORD_SIZE];
+  int fd0, fd1, fd;
+  int i;
+
+  /* Use the newest snapshot that is intact. If the last write was
+     cut short, this is the one written before it. */
+  fd0 = open_snapshot(c, 0, &h0);
+  fd1 = open_snapshot(c, 1, &h1);
+  if(fd0 >= 0 && fd1 >= 0) {
+    if((int8_t)(h1.seqno - h0.seqno) > 0) {
+      cfs_close(fd0);
+      fd0 = -1;
+    } else {
+      cfs_close(fd1);
+      fd1 = -1;
+    }
+  }
+  if(fd0 >= 0) {
+    fd = fd0;
+    h = &h0;
+    c->file = 0;
+  } else if(fd1 >= 0) {
+    fd = fd1;
+    h = &h1;
+    c->file = 1;
+  } else {
+    return;
+  }
+  c->seqno = h->seqno;
+
+  for(i = 0; i < h->num; i++) {
+    cfs_read(fd, record, c->record_size);
+    c->restore(c, record);
+  }
+  cfs_close(fd);
+
+  PRINTF("state-checkpoint: %s%u restored %u records\n",
+         c->name, c->file, h->num);
+}
+/*---------------------------------------------------------------------------*/
+static void
+save(struct state_checkpoint *c)
+{
+  char name[STATE_CHECKPOINT_NAME_LEN + 1];
+  struct header h;
+  uint8_t record[STATE_CHECKPOINT_MAX_RECORD_SIZE];
+  uint16_t crc;
+  uint8_t file;
+  int fd;
+  int i;
+
+  memset(&h, 0, sizeof(h));
+  crc = 0;
+  for(h.num = 0; h.num < c->max_records && c->save(c, h.num, record); h.num++) {
+    crc = crc16_data(record, c->record_size, crc);
+  }
+  crc = crc16_add(h.num, crc);
+  if(c->saved && crc == c->crc) {
+    /* Nothing has changed since the last snapshot. The first snapshot
+       of a boot is always written, so that it stays within the boot
+       limit. */
+    return;
+  }
+
+  /* Overwrite the older of the two snapshots. */
+  file = c->file ^ 1;
+  filename(c, file, name);
+  fd = cfs_open(name, CFS_WRITE);
+  if(fd < 0) {
+    return;
+  }
+  h.version = VERSION;
+  h.record_size = c->record_size;
+  h.seqno = c->seqno + 1;
+  h.boot = boot_count;
+  h.crc = crc;
+  h.time = STATE_CHECKPOINT_TIME();
+  if(cfs_write(fd, &h, sizeof(h)) != sizeof(h)) {
+    cfs_close(fd);
+    return;
+  }
+  for(i = 0; i < h.num; i++) {
+    c->save(c, i, record);
+    if(cfs_write(fd, record, c->record_size) != c->record_size) {
+      cfs_close(fd);
+      return;
+    }
+  }
+  cfs_close(fd);
+  c->file = file;
+  c->seqno = h.seqno;
+  c->crc = crc;
+  c->saved = 1;
+  PRINTF("state-checkpoint: %s saved %u records\n", name, h.num);
+}
+/*---------------------------------------------------------------------------*/
+void
+state_checkpoint_register(struct state_checkpoint *c, const char *name,
+                          uint8_t record_size, uint8_t max_records,
+                          int (* save)(struct state_checkpoint *c,
+                                       int index, void *record),
+                          void (* restore_record)(struct state_checkpoint *c,
+                                                  const void *record))
+{
+  init();
+
+  if(record_size > STATE_CHECKPOINT_MAX_RECORD_SIZE) {
+    return;
+  }
+  strncpy(c->name, name, sizeof(c->name) - 1);
+  c->name[sizeof(c->name) - 1] = 0;
+  c->record_size = record_size;
+  c->max_records = max_records;
+  c->save = save;
+  c->restore = restore_record;
+  c->crc = 0;
+  c->saved = 0;
+  c->seqno = 0;
+  c->file = 1;
+
+#if STATE_CHECKPOINT_CONF_WITH_COFFEE
+  {
+    char fname[STATE_CHECKPOINT_NAME_LEN + 1];
+    uint8_t i;
+
+    /* Allocate both files at their largest size once, so that Coffee
+       can overwrite them in place instead of growing and relocating
+       them on later writes. Reserving a file that exists fails
+       harmlessly. */
+    for(i = 0; i < 2; i++) {
+      filename(c, i, fname);
+      cfs_coffee_reserve(fname, sizeof(struct header) +
+                         (cfs_offset_t)record_size * max_records);
+    }
+  }
+#endif /* STATE_CHECKPOINT_CONF_WITH_COFFEE */
+
+  restore(c);
+  list_remove(checkpoints, c);
+  list_add(checkpoints, c);
+}
+/*---------------------------------------------------------------------------*/
+void
+state_checkpoint_unregister(struct state_checkpoint *c)
+{
+  list_remove(checkpoints, c);
+}
+/*---------------------------------------------------------------------------*/
+void
+state_checkpoint_flush(void)
+{
+  struct state_checkpoint *c;
+
+  for(c = list_head(checkpoints); c != NULL; c = list_item_next(c)) {
+    save(c);
+  }
+}
+/*---------------------------------------------------------------------------*/
+uint16_t
+state_checkpoint_boot_count(void)
+{
+  init();
+  return boot_count;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(state_checkpoint_process, ev, data)
+{
+  static struct etimer et;
+  static uint16_t elapsed;
+
+  PROCESS_BEGIN();
+
+  elapsed = 0;
+  etimer_set(&et, TICK_SECONDS * CLOCK_SECOND);
+  while(1) {
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
+    etimer_reset(&et);
+    elapsed += TICK_SECONDS;
+    if(elapsed >= STATE_CHECKPOINT_INTERVAL) {
+      elapsed = 0;
+      state_checkpoint_flush();
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
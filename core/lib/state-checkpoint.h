@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Persistent snapshots of run-time state tables
+ *
+ *         A state checkpoint is a small table (e.g., a neighbor list)
+ *         that is periodically written to the file system so that it
+ *         can be restored after a reboot instead of being relearned
+ *         from scratch. Each registered table is serialized into
+ *         fixed-size records through a save callback. A background
+ *         process writes at most one snapshot per table every
+ *         STATE_CHECKPOINT_INTERVAL, and only when the contents have
+ *         changed since the last write of the current boot, to limit
+ *         flash wear. Writes alternate between two files per table,
+ *         so an interrupted write falls back to the previous
+ *         snapshot. With STATE_CHECKPOINT_CONF_WITH_COFFEE, both files
+ *         are reserved at their full size in Coffee so that they are
+ *         rewritten in place.
+ *
+ *         A snapshot is only restored if it was written during one
+ *         of the last STATE_CHECKPOINT_MAX_BOOTS boots. Platforms
+ *         that have a clock that survives reboots may define
+ *         STATE_CHECKPOINT_CONF_TIME() to also reject snapshots that
+ *         are older than STATE_CHECKPOINT_MAX_AGE seconds.
+ */
+
+#ifndef __STATE_CHECKPOINT_H__
+#define __STATE_CHECKPOINT_H__
+
+#include "contiki.h"
+#include "sys/timer.h"
+
+#define STATE_CHECKPOINT_NAME_LEN 8
+
+struct state_checkpoint {
+  struct state_checkpoint *next;
+  char name[STATE_CHECKPOINT_NAME_LEN];
+  uint8_t record_size;
+  uint8_t max_records;
+  uint16_t crc;
+  uint8_t seqno, file, saved;
+  /** Copy record number index into record. Returns zero when there
+      are no more records. */
+  int (* save)(struct state_checkpoint *c, int index, void *record);
+  /** Re-create the state described by one record. */
+  void (* restore)(struct state_checkpoint *c, const void *record);
+};
+
+/**
+ * \brief      Register a state table and restore its last snapshot
+ * \param c    A pointer to a struct state_checkpoint
+ * \param name The base name of the two snapshot files, at most
+ *             STATE_CHECKPOINT_NAME_LEN - 1 characters. A digit is
+ *             appended to it for each file.
+ * \param record_size The size of one serialized record
+ * \param max_records The maximum number of records in a snapshot
+ * \param save The callback that serializes one record
+ * \param restore The callback that restores one record
+ *
+ *             The restore callback is called once for every record
+ *             in a valid snapshot before this function returns.
+ *             Record_size must not be larger than
+ *             STATE_CHECKPOINT_MAX_RECORD_SIZE.
+ */
+void state_checkpoint_register(struct state_checkpoint *c, const char *name,
+                               uint8_t record_size, uint8_t max_records,
+                               int (* save)(struct state_checkpoint *c,
+                                            int index, void *record),
+                               void (* restore)(struct state_checkpoint *c,
+                                                const void *record));
+
+/**
+ * \brief      Stop writing snapshots of a state table
+ * \param c    A pointer to a registered struct state_checkpoint
+ */
+void state_checkpoint_unregister(struct state_checkpoint *c);
+
+/**
+ * \brief      Write snapshots of all changed tables immediately
+ *
+ *             This function can be called before a planned reboot
+ *             so that the latest state is preserved regardless of
+ *             the write rate limit.
+ */
+void state_checkpoint_flush(void);
+
+/**
+ * \brief      The number of times the node has booted
+ *
+ *             The boot counter is kept in the file system and is
+ *             incremented when the first state table is registered.
+ */
+uint16_t state_checkpoint_boot_count(void);
+
+#endif /* __STATE_CHECKPOINT_H__ */
@@ -66,6 +66,7 @@
 #ifndef __ELFLOADER_ARCH_H__
 #define __ELFLOADER_ARCH_H__
 
+#include "sys/process.h"
 #include "loader/elfloader.h"
 
 /**
@@ -134,6 +135,47 @@ void elfloader_arch_relocate(int fd, unsigned int sectionoffset,
  */
 void elfloader_arch_write_rom(int fd, unsigned short textoff, unsigned int size, char *mem);
 
+/**
+ * \brief      Write a buffer to read-only memory.
+ * \param buf  The data to write.
+ * \param size The number of bytes in buf.
+ * \param mem  A pointer to where the data should be flashed
+ *
+ *             This function is called from the streaming loader
+ *             (\ref elfloader-stream.h) to write relocated code into
+ *             program memory. It is called with consecutive pieces of
+ *             a segment, in order, so mem is always just past the
+ *             previously written piece.
+ */
+void elfloader_arch_write_rom_buf(const char *buf, unsigned int size, char *mem);
+
+/**
+ * \brief      Isolate a loaded module.
+ * \param processes The autostart processes of the module.
+ * \return     ELFLOADER_OK, or an error value if the module could
+ *             not be isolated.
+ *
+ *             This function is called from the Contiki ELF loader
+ *             when ELFLOADER_PROTECT is set, after the module most
+ *             recently allocated with elfloader_arch_allocate_ram()
+ *             and elfloader_arch_allocate_rom() has been written to
+ *             memory but before any of its processes are started.
+ */
+int elfloader_arch_protect(struct process * const *processes);
+
+/**
+ * \brief      Choose the address a module links to for a system symbol.
+ * \param addr The address of the symbol in the system, or NULL.
+ * \return     The address that the module should use instead.
+ *
+ *             This function is called from the Contiki ELF loader
+ *             when ELFLOADER_PROTECT is set, for every symbol that a
+ *             module imports from the system. It lets the
+ *             architecture replace system functions with versions
+ *             that keep the module isolated.
+ */
+void *elfloader_arch_symbol(void *addr);
+
 #endif /* __ELFLOADER_ARCH_H__ */
 
 /** @} */
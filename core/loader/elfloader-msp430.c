@@ -34,6 +34,8 @@
 
 #include "dev/flash.h"
 
+#include <string.h>
+
 static uint16_t datamemory_aligned[ELFLOADER_DATAMEMORY_SIZE/2+1];
 static uint8_t* datamemory = (uint8_t *)datamemory_aligned;
 #if ELFLOADER_CONF_TEXT_IN_ROM
@@ -104,6 +106,35 @@ elfloader_arch_write_rom(int fd, unsigned short textoff, unsigned int size, char
 }
 /*---------------------------------------------------------------------------*/
 void
+elfloader_arch_write_rom_buf(const char *buf, unsigned int size, char *mem)
+{
+#if ELFLOADER_CONF_TEXT_IN_ROM
+  unsigned int i;
+  unsigned short *flashptr;
+
+  flash_setup();
+
+  flashptr = (unsigned short *)mem;
+
+  /* The buffer is not necessarily word aligned, so the words are put
+     together from bytes. An odd last byte is padded with 0xff. */
+  for(i = 0; i < size; i += 2) {
+    /* Clear flash page on 512 byte boundary. */
+    if((((unsigned short)flashptr) & 0x01ff) == 0) {
+      flash_clear(flashptr);
+    }
+    flash_write(flashptr, (unsigned char)buf[i] |
+                ((i + 1 < size ? (unsigned char)buf[i + 1] : 0xff) << 8));
+    ++flashptr;
+  }
+
+  flash_done();
+#else /* ELFLOADER_CONF_TEXT_IN_ROM */
+  memcpy(mem, buf, size);
+#endif /* ELFLOADER_CONF_TEXT_IN_ROM */
+}
+/*---------------------------------------------------------------------------*/
+void
 elfloader_arch_relocate(int fd, unsigned int sectionoffset,
 			char *sectionaddr,
 			struct elf32_rela *rela, char *addr)
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Loading modules directly from a byte stream
+ */
+
+#include "contiki.h"
+
+#include "loader/elfloader-arch.h"
+#include "loader/elfloader-stream.h"
+#include "loader/symtab.h"
+
+#include <string.h>
+
+#define DEBUG 0
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...) do {} while (0)
+#endif
+
+#ifdef ELFLOADER_STREAM_CONF_MAX_SYMBOLS
+#define MAX_SYMBOLS ELFLOADER_STREAM_CONF_MAX_SYMBOLS
+#else /* ELFLOADER_STREAM_CONF_MAX_SYMBOLS */
+#define MAX_SYMBOLS 32
+#endif /* ELFLOADER_STREAM_CONF_MAX_SYMBOLS */
+
+/* Relocated code is collected in a buffer of this size before it is
+   written to program memory. */
+#ifdef ELFLOADER_STREAM_CONF_ROMBUF_SIZE
+#define ROMBUF_SIZE ELFLOADER_STREAM_CONF_ROMBUF_SIZE
+#else /* ELFLOADER_STREAM_CONF_ROMBUF_SIZE */
+#define ROMBUF_SIZE 32
+#endif /* ELFLOADER_STREAM_CONF_ROMBUF_SIZE */
+
+#define RELOC_SIZE 5
+
+enum {
+  STATE_HEADER,
+  STATE_SYMBOL_LEN,
+  STATE_SYMBOL,
+  STATE_OP,
+  STATE_DATA_LEN,
+  STATE_DATA,
+  STATE_RELOC,
+  STATE_DONE,
+  STATE_ERROR
+};
+
+static struct {
+  uint8_t state;
+  uint8_t segment;
+  uint8_t op;
+  uint8_t nsyms;
+  uint8_t sym;
+  uint8_t len;
+  uint8_t ptr;
+  uint8_t autostart_seg;
+  uint16_t autostart_off;
+  uint16_t segpos;
+  uint16_t rombufptr;
+  char *rommem;
+  union {
+    uint8_t hdr[ELFLOADER_STREAM_HDR_SIZE];
+    char name[sizeof(elfloader_unknown)];
+    uint8_t reloc[RELOC_SIZE];
+  } u;
+} s;
+
+static uint16_t sizes[ELFLOADER_STREAM_SEG_BSS + 1];
+static char *bases[ELFLOADER_STREAM_SEG_BSS + 1];
+static void *syms[MAX_SYMBOLS];
+static char rombuf[ROMBUF_SIZE];
+
+/*---------------------------------------------------------------------------*/
+static uint16_t
+get16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+/*---------------------------------------------------------------------------*/
+static void
+flush_rom(void)
+{
+  if(s.rombufptr > 0) {
+    elfloader_arch_write_rom_buf(rombuf, s.rombufptr, s.rommem);
+    s.rommem += s.rombufptr;
+    s.rombufptr = 0;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Move on to the next segment that has any bytes in it. Returns
+   non-zero when all segments are done. */
+static int
+next_segment(void)
+{
+  s.segpos = 0;
+  while(s.segment < ELFLOADER_STREAM_SEG_DATA) {
+    s.segment++;
+    if(s.segment == ELFLOADER_STREAM_SEG_DATA) {
+      /* The code is complete. */
+      flush_rom();
+    }
+    if(sizes[s.segment] > 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+output(uint8_t c)
+{
+  if(s.segment == ELFLOADER_STREAM_SEG_DATA) {
+    bases[s.segment][s.segpos] = c;
+  } else {
+    rombuf[s.rombufptr++] = c;
+    if(s.rombufptr == ROMBUF_SIZE) {
+      flush_rom();
+    }
+  }
+  s.segpos++;
+}
+/*---------------------------------------------------------------------------*/
+static int
+relocate(void)
+{
+  uint8_t target;
+  char *addr;
+  unsigned long value;
+  int i, size;
+
+  target = s.u.reloc[0];
+  if(target >= ELFLOADER_STREAM_TARGET_SEGMENT) {
+    target -= ELFLOADER_STREAM_TARGET_SEGMENT;
+    if(target == 0 || target > ELFLOADER_STREAM_SEG_BSS) {
+      return ELFLOADER_STREAM_BAD_FORMAT;
+    }
+    addr = bases[target];
+  } else if(target < s.nsyms) {
+    addr = syms[target];
+  } else {
+    return ELFLOADER_STREAM_BAD_FORMAT;
+  }
+
+  value = (unsigned long)addr +
+    (s.u.reloc[1] | ((unsigned long)s.u.reloc[2] << 8) |
+     ((unsigned long)s.u.reloc[3] << 16) | ((unsigned long)s.u.reloc[4] << 24));
+
+  size = s.op == ELFLOADER_STREAM_OP_ABS16 ? 2 : 4;
+  if(s.op == ELFLOADER_STREAM_OP_PCREL32) {
+    value -= (unsigned long)(bases[s.segment] + s.segpos);
+  }
+  if(s.segpos + size > sizes[s.segment]) {
+    return ELFLOADER_STREAM_BAD_FORMAT;
+  }
+  for(i = 0; i < size; i++) {
+    output(value & 0xff);
+    value >>= 8;
+  }
+  return ELFLOADER_OK;
+}
+/*---------------------------------------------------------------------------*/
+static int
+start(void)
+{
+  sizes[ELFLOADER_STREAM_SEG_TEXT] = get16(&s.u.hdr[4]);
+  sizes[ELFLOADER_STREAM_SEG_RODATA] = get16(&s.u.hdr[6]);
+  sizes[ELFLOADER_STREAM_SEG_DATA] = get16(&s.u.hdr[8]);
+  sizes[ELFLOADER_STREAM_SEG_BSS] = get16(&s.u.hdr[10]);
+  s.nsyms = s.u.hdr[12];
+
+  if(sizes[ELFLOADER_STREAM_SEG_TEXT] == 0) {
+    return ELFLOADER_NO_TEXT;
+  }
+  if(s.nsyms > MAX_SYMBOLS) {
+    return ELFLOADER_STREAM_BAD_FORMAT;
+  }
+
+  /* Same layout as elfloader_load(): .text and .rodata in ROM, .bss
+     and .data in RAM. */
+  bases[ELFLOADER_STREAM_SEG_BSS] = (char *)
+    elfloader_arch_allocate_ram(sizes[ELFLOADER_STREAM_SEG_BSS] +
+                                sizes[ELFLOADER_STREAM_SEG_DATA]);
+  bases[ELFLOADER_STREAM_SEG_DATA] =
+    bases[ELFLOADER_STREAM_SEG_BSS] + sizes[ELFLOADER_STREAM_SEG_BSS];
+  bases[ELFLOADER_STREAM_SEG_TEXT] = (char *)
+    elfloader_arch_allocate_rom(sizes[ELFLOADER_STREAM_SEG_TEXT] +
+                                sizes[ELFLOADER_STREAM_SEG_RODATA]);
+  bases[ELFLOADER_STREAM_SEG_RODATA] =
+    bases[ELFLOADER_STREAM_SEG_TEXT] + sizes[ELFLOADER_STREAM_SEG_TEXT];
+  memset(bases[ELFLOADER_STREAM_SEG_BSS], 0, sizes[ELFLOADER_STREAM_SEG_BSS]);
+
+  s.rommem = bases[ELFLOADER_STREAM_SEG_TEXT];
+  s.rombufptr = 0;
+  s.segment = ELFLOADER_STREAM_SEG_TEXT;
+  s.segpos = 0;
+
+  /* The memory of any previously loaded module is reused, so its
+     autostart list is gone. The new one is published only when the
+     module is complete. */
+  elfloader_autostart_processes = NULL;
+  s.autostart_seg = s.u.hdr[13];
+  s.autostart_off = get16(&s.u.hdr[14]);
+  if(s.autostart_seg > ELFLOADER_STREAM_SEG_BSS) {
+    return ELFLOADER_STREAM_BAD_FORMAT;
+  }
+
+  PRINTF("elfloader-stream: text %u rodata %u data %u bss %u syms %u\n",
+         sizes[1], sizes[2], sizes[3], sizes[4], s.nsyms);
+  return ELFLOADER_OK;
+}
+/*---------------------------------------------------------------------------*/
+int
+elfloader_stream_check(const unsigned char *data, int len)
+{
+  return len >= 4 &&
+    data[0] == ELFLOADER_STREAM_MAGIC0 &&
+    data[1] == ELFLOADER_STREAM_MAGIC1 &&
+    data[2] == ELFLOADER_STREAM_MAGIC2 &&
+    data[3] == ELFLOADER_STREAM_VERSION;
+}
+/*---------------------------------------------------------------------------*/
+void
+elfloader_stream_init(void)
+{
+  memset(&s, 0, sizeof(s));
+  s.state = STATE_HEADER;
+  elfloader_unknown[0] = 0;
+}
+/*---------------------------------------------------------------------------*/
+static int
+finish(void)
+{
+  struct process * const *processes;
+#if ELFLOADER_PROTECT
+  int ret;
+#endif /* ELFLOADER_PROTECT */
+
+  if(s.autostart_seg == 0) {
+    return ELFLOADER_NO_STARTPOINT;
+  }
+  processes = (struct process * const *)
+    (bases[s.autostart_seg] + s.autostart_off);
+#if ELFLOADER_PROTECT
+  ret = elfloader_arch_protect(processes);
+  if(ret != ELFLOADER_OK) {
+    return ret;
+  }
+#endif /* ELFLOADER_PROTECT */
+  elfloader_autostart_processes = processes;
+  return ELFLOADER_OK;
+}
+/*---------------------------------------------------------------------------*/
+static int
+input_byte(uint8_t c)
+{
+  int ret;
+
+  switch(s.state) {
+  case STATE_HEADER:
+    s.u.hdr[s.ptr++] = c;
+    if(s.ptr < ELFLOADER_STREAM_HDR_SIZE) {
+      return ELFLOADER_STREAM_MORE;
+    }
+    if(!elfloader_stream_check(s.u.hdr, s.ptr)) {
+      return ELFLOADER_BAD_ELF_HEADER;
+    }
+    ret = start();
+    if(ret != ELFLOADER_OK) {
+      return ret;
+    }
+    s.sym = 0;
+    s.state = s.nsyms > 0 ? STATE_SYMBOL_LEN : STATE_OP;
+    break;
+
+  case STATE_SYMBOL_LEN:
+    if(c == 0 || c >= sizeof(s.u.name)) {
+      return ELFLOADER_STREAM_BAD_FORMAT;
+    }
+    s.len = c;
+    s.ptr = 0;
+    s.state = STATE_SYMBOL;
+    break;
+
+  case STATE_SYMBOL:
+    s.u.name[s.ptr++] = c;
+    if(s.ptr < s.len) {
+      return ELFLOADER_STREAM_MORE;
+    }
+    s.u.name[s.ptr] = 0;
+    syms[s.sym] = symtab_lookup(s.u.name);
+#if ELFLOADER_PROTECT
+    syms[s.sym] = elfloader_arch_symbol(syms[s.sym]);
+#endif /* ELFLOADER_PROTECT */
+    PRINTF("elfloader-stream: %s at %p\n", s.u.name, syms[s.sym]);
+    if(syms[s.sym] == NULL) {
+      memcpy(elfloader_unknown, s.u.name, sizeof(elfloader_unknown));
+      return ELFLOADER_SYMBOL_NOT_FOUND;
+    }
+    if(++s.sym == s.nsyms) {
+      s.state = STATE_OP;
+    } else {
+      s.state = STATE_SYMBOL_LEN;
+    }
+    break;
+
+  case STATE_OP:
+    s.op = c;
+    s.ptr = 0;
+    if(c == ELFLOADER_STREAM_OP_DATA) {
+      s.state = STATE_DATA_LEN;
+    } else if(c <= ELFLOADER_STREAM_OP_PCREL32) {
+      s.state = STATE_RELOC;
+    } else {
+      return ELFLOADER_STREAM_BAD_FORMAT;
+    }
+    break;
+
+  case STATE_DATA_LEN:
+    if(c == 0 || s.segpos + c > sizes[s.segment]) {
+      return ELFLOADER_STREAM_BAD_FORMAT;
+    }
+    s.len = c;
+    s.state = STATE_DATA;
+    break;
+
+  case STATE_DATA:
+    output(c);
+    if(--s.len > 0) {
+      return ELFLOADER_STREAM_MORE;
+    }
+    s.state = STATE_OP;
+    break;
+
+  case STATE_RELOC:
+    s.u.reloc[s.ptr++] = c;
+    if(s.ptr < RELOC_SIZE) {
+      return ELFLOADER_STREAM_MORE;
+    }
+    ret = relocate();
+    if(ret != ELFLOADER_OK) {
+      return ret;
+    }
+    s.state = STATE_OP;
+    break;
+
+  default:
+    /* Trailing bytes after the module are ignored. */
+    return ELFLOADER_OK;
+  }
+
+  if(s.state == STATE_OP && s.segpos == sizes[s.segment] &&
+     next_segment()) {
+    s.state = STATE_DONE;
+    return finish();
+  }
+  return ELFLOADER_STREAM_MORE;
+}
+/*---------------------------------------------------------------------------*/
+int
+elfloader_stream_input(const unsigned char *data, int len)
+{
+  int ret;
+
+  if(s.state == STATE_ERROR) {
+    return ELFLOADER_STREAM_BAD_FORMAT;
+  }
+
+  ret = ELFLOADER_STREAM_MORE;
+  while(len-- > 0) {
+    ret = input_byte(*data++);
+    if(ret != ELFLOADER_STREAM_MORE) {
+      if(ret != ELFLOADER_OK) {
+        s.state = STATE_ERROR;
+      }
+      return ret;
+    }
+  }
+  return ret;
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,145 @@
+/**
+ * \addtogroup elfloader
+ * @{
+ */
+
+/**
+ * \file
+ *         Loading modules directly from a byte stream
+ *
+ *         The streaming loader links and loads a module as its bytes
+ *         arrive, e.g. from the network, without first storing it
+ *         in a file. Only the final relocated code is written to
+ *         program memory.
+ *
+ *         This requires the module to be in a streamable layout,
+ *         which tools/elf2stream produces from an ELF object file:
+ *         the names of the external symbols come first, followed by
+ *         the .text, .rodata, and .data segments in that order. Each
+ *         relocation is placed in the segment data at the position
+ *         it applies to, with local symbols already resolved by the
+ *         tool.
+ *
+ *         Stream format (all multi-byte values are little endian):
+ *
+ *         Header, 16 bytes:
+ *           magic (4), text size (2), rodata size (2), data size (2),
+ *           bss size (2), number of symbols (1), autostart segment (1),
+ *           autostart offset (2)
+ *         Symbols: a length byte followed by the name, for each symbol
+ *         Segments: records until all bytes of the segment are produced
+ *           ELFLOADER_STREAM_OP_DATA: length (1), bytes
+ *           ELFLOADER_STREAM_OP_ABS16/ABS32/PCREL32: target (1), addend (4)
+ *
+ *         The relocation target is either the index of an external
+ *         symbol or ELFLOADER_STREAM_TARGET_SEGMENT plus a segment
+ *         number.
+ *
+ *         The streaming loader uses the elfloader_arch_allocate_ram()
+ *         and elfloader_arch_allocate_rom() functions, and
+ *         elfloader_arch_write_rom_buf() for writing program memory.
+ */
+
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+#ifndef __ELFLOADER_STREAM_H__
+#define __ELFLOADER_STREAM_H__
+
+#include "loader/elfloader.h"
+
+#define ELFLOADER_STREAM_MAGIC0   0x7f
+#define ELFLOADER_STREAM_MAGIC1   'C'
+#define ELFLOADER_STREAM_MAGIC2   'S'
+#define ELFLOADER_STREAM_VERSION  1
+
+#define ELFLOADER_STREAM_HDR_SIZE 16
+
+#define ELFLOADER_STREAM_OP_DATA    0
+#define ELFLOADER_STREAM_OP_ABS16   1
+#define ELFLOADER_STREAM_OP_ABS32   2
+#define ELFLOADER_STREAM_OP_PCREL32 3
+
+#define ELFLOADER_STREAM_SEG_TEXT   1
+#define ELFLOADER_STREAM_SEG_RODATA 2
+#define ELFLOADER_STREAM_SEG_DATA   3
+#define ELFLOADER_STREAM_SEG_BSS    4
+
+#define ELFLOADER_STREAM_TARGET_SEGMENT 0xf0
+
+/**
+ * Return value from elfloader_stream_input() indicating that more
+ * input is needed.
+ */
+#define ELFLOADER_STREAM_MORE        -1
+/**
+ * Return value from elfloader_stream_input() indicating that the
+ * stream was malformed or used more symbols than
+ * ELFLOADER_STREAM_CONF_MAX_SYMBOLS.
+ */
+#define ELFLOADER_STREAM_BAD_FORMAT  12
+
+/**
+ * \brief      Check if data is the start of a streamable module
+ * \param data The first bytes of a received module
+ * \param len  The number of bytes in data
+ * \return     Non-zero if data starts with the stream magic
+ */
+int elfloader_stream_check(const unsigned char *data, int len);
+
+/**
+ * \brief      Start loading a new module
+ *
+ *             This function resets the streaming loader. It must be
+ *             called before the first byte of a module is passed to
+ *             elfloader_stream_input().
+ */
+void elfloader_stream_init(void);
+
+/**
+ * \brief      Pass the next bytes of a module to the loader
+ * \param data The bytes
+ * \param len  The number of bytes
+ * \return     ELFLOADER_STREAM_MORE if the module is not complete,
+ *             ELFLOADER_OK if it was loaded, otherwise an error value.
+ *
+ *             The bytes are linked and relocated as they arrive. Once
+ *             the last byte has been passed in, the module is ready
+ *             to be started through elfloader_autostart_processes,
+ *             just as after elfloader_load(). After an error, the
+ *             rest of the module is ignored.
+ */
+int elfloader_stream_input(const unsigned char *data, int len);
+
+#endif /* __ELFLOADER_STREAM_H__ */
+
+/** @} */
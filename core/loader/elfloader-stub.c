@@ -56,6 +56,12 @@ elfloader_arch_write_rom(int fd, unsigned short textoff, unsigned int size, char
 }
 /*---------------------------------------------------------------------------*/
 void
+elfloader_arch_write_rom_buf(const char *buf, unsigned int size, char *mem)
+{
+  printf("elfloader_arch_write_rom_buf: size %d, mem %p\n", size, mem);
+}
+/*---------------------------------------------------------------------------*/
+void
 elfloader_arch_relocate(int fd, unsigned int sectionoffset,
 			char *sectionaddr,
 			struct elf32_rela *rela, char *addr)
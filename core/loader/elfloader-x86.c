@@ -34,6 +34,14 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
+
+#if ELFLOADER_PROTECT
+#include <setjmp.h>
+#include <signal.h>
+#include <stddef.h>
+#include <unistd.h>
+#endif /* ELFLOADER_PROTECT */
 
 #define R_386_NONE          0
 #define R_386_32            1
@@ -49,6 +57,357 @@
 
 #define ELF32_R_TYPE(info)      ((unsigned char)(info))
 
+#if ELFLOADER_PROTECT
+
+/*
+ * In protected mode, every module gets text and data pages of its
+ * own. The text is only writable while the loader writes it. The
+ * threads of the module's processes are called through
+ * protected_thread(), which catches memory faults: the module is
+ * then stopped and its text made non-executable, and the system
+ * carries on. Calls from a module to process_start() are linked to
+ * protected_start(), so that a process that the module starts is
+ * protected from its first event on. Faults in callbacks that the
+ * kernel calls directly, such as ctimer callbacks, are not caught.
+ */
+
+#ifdef ELFLOADER_CONF_PROTECT_MODULES
+#define PROTECT_MODULES ELFLOADER_CONF_PROTECT_MODULES
+#else /* ELFLOADER_CONF_PROTECT_MODULES */
+#define PROTECT_MODULES 8
+#endif /* ELFLOADER_CONF_PROTECT_MODULES */
+
+#ifdef ELFLOADER_CONF_PROTECT_PROCESSES
+#define PROTECT_PROCESSES ELFLOADER_CONF_PROTECT_PROCESSES
+#else /* ELFLOADER_CONF_PROTECT_PROCESSES */
+#define PROTECT_PROCESSES 4
+#endif /* ELFLOADER_CONF_PROTECT_PROCESSES */
+
+typedef PT_THREAD((* thread_t)(struct pt *, process_event_t,
+			       process_data_t));
+
+struct module {
+  char *text, *data;
+  size_t textsize, datasize;
+  struct process * const *autostart;
+  struct process *procs[PROTECT_PROCESSES];
+  thread_t threads[PROTECT_PROCESSES];
+  unsigned char state;
+};
+
+#define MODULE_FREE    0
+#define MODULE_LOADED  1
+#define MODULE_FAULTED 2
+
+static struct module modules[PROTECT_MODULES];
+
+/* The memory of the module being loaded. */
+static struct module loading;
+
+/* Where to go on a fault, set while a module thread runs. */
+static sigjmp_buf *fault_env;
+static void *fault_addr;
+
+/* The process list as it was when last searched for new module
+   processes. */
+static struct process *known_list;
+
+static PT_THREAD(protected_thread(struct pt *pt, process_event_t ev,
+				  process_data_t data));
+
+/*---------------------------------------------------------------------------*/
+static char *
+map_pages(size_t *size)
+{
+  long page = sysconf(_SC_PAGESIZE);
+  char *mem;
+
+  *size = (*size + page - 1) & ~(page - 1);
+  if(*size == 0) {
+    *size = page;
+  }
+  mem = mmap(NULL, *size, PROT_READ | PROT_WRITE,
+	     MAP_PRIVATE | MAP_ANON, -1, 0);
+  if(mem == MAP_FAILED) {
+    *size = 0;
+    return NULL;
+  }
+  return mem;
+}
+/*---------------------------------------------------------------------------*/
+static void
+fault_handler(int sig, siginfo_t *info, void *context)
+{
+  if(fault_env != NULL) {
+    fault_addr = info->si_addr;
+    siglongjmp(*fault_env, sig);
+  }
+  /* Not in a module: let the fault take its default course when the
+     faulting instruction is retried. */
+  signal(sig, SIG_DFL);
+}
+/*---------------------------------------------------------------------------*/
+static void
+init_fault_handler(void)
+{
+  static const int sigs[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE};
+  static int initialized;
+  struct sigaction sa;
+  int i;
+
+  if(initialized) {
+    return;
+  }
+  initialized = 1;
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_sigaction = fault_handler;
+  /* The handler is left with siglongjmp(), so it must not leave the
+     signal blocked. */
+  sa.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&sa.sa_mask);
+  for(i = 0; i < sizeof(sigs) / sizeof(sigs[0]); ++i) {
+    sigaction(sigs[i], &sa, NULL);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static struct module *
+module_of(const void *ptr)
+{
+  struct module *m;
+
+  for(m = modules; m < &modules[PROTECT_MODULES]; ++m) {
+    if(m->state != MODULE_FREE &&
+       (const char *)ptr >= m->data &&
+       (const char *)ptr < m->data + m->datasize) {
+      return m;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static int
+wrap(struct module *m, struct process *p)
+{
+  int i;
+
+  for(i = 0; i < PROTECT_PROCESSES; ++i) {
+    if(m->procs[i] == NULL) {
+      m->procs[i] = p;
+      m->threads[i] = p->thread;
+      p->thread = protected_thread;
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+/* Wrap the processes that modules have started since the last time. */
+static void
+wrap_started(void)
+{
+  struct process *p;
+  struct module *m;
+
+  known_list = process_list;
+  for(p = process_list; p != NULL; p = p->next) {
+    if(p->thread != protected_thread) {
+      m = module_of(p);
+      if(m != NULL && !wrap(m, p)) {
+	printf("elfloader: process '%s' runs unprotected\n",
+	       PROCESS_NAME_STRING(p));
+      }
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+stop_module(struct module *m)
+{
+  int i;
+
+  m->state = MODULE_FAULTED;
+  for(i = 0; i < PROTECT_PROCESSES && m->procs[i] != NULL; ++i) {
+    if(m->procs[i] != PROCESS_CURRENT()) {
+      process_exit(m->procs[i]);
+    }
+  }
+  /* Keep the text readable, as the kernel may still print the names
+     of the module's processes. */
+  mprotect(m->text, m->textsize, PROT_READ);
+}
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(protected_thread(struct pt *pt, process_event_t ev,
+			   process_data_t data))
+{
+  struct process *p;
+  struct module *m;
+  sigjmp_buf env, *prev;
+  thread_t thread;
+  char ret;
+  int i;
+
+  p = (struct process *)((char *)pt - offsetof(struct process, pt));
+  m = module_of(p);
+  if(m == NULL || m->state != MODULE_LOADED) {
+    return PT_EXITED;
+  }
+  for(i = 0; m->procs[i] != p; ++i);
+  thread = m->threads[i];
+
+  prev = fault_env;
+  if(sigsetjmp(env, 0) != 0) {
+    fault_env = prev;
+    printf("elfloader: fault at %p in process '%s', unloading module\n",
+	   fault_addr, PROCESS_NAME_STRING(p));
+    stop_module(m);
+    return PT_EXITED;
+  }
+  fault_env = &env;
+  ret = thread(pt, ev, data);
+  fault_env = prev;
+
+  if(m->state != MODULE_LOADED) {
+    /* A process that this one started has faulted. */
+    return PT_EXITED;
+  }
+
+  if(process_list != known_list) {
+    wrap_started();
+  }
+  return ret;
+}
+/*---------------------------------------------------------------------------*/
+/* Replaces process_start() for modules: the process is wrapped
+   before its initialization event is dispatched. */
+static void
+protected_start(struct process *p, const char *arg)
+{
+  struct module *m;
+
+  if(p->thread != protected_thread) {
+    m = module_of(p);
+    if(m != NULL && !wrap(m, p)) {
+      printf("elfloader: process '%s' runs unprotected\n",
+	     PROCESS_NAME_STRING(p));
+    }
+  }
+  process_start(p, arg);
+}
+/*---------------------------------------------------------------------------*/
+static struct module *
+free_module(void)
+{
+  struct module *m;
+  int i;
+
+  for(m = modules; m < &modules[PROTECT_MODULES]; ++m) {
+    if(m->state == MODULE_FREE) {
+      return m;
+    }
+  }
+
+  /* Events may still be queued for the processes of a stopped module,
+     so its memory is only reused when the event queue is empty. */
+  if(process_nevents() > 0) {
+    return NULL;
+  }
+  for(m = modules; m < &modules[PROTECT_MODULES]; ++m) {
+    for(i = 0; i < PROTECT_PROCESSES && m->procs[i] != NULL; ++i) {
+      if(process_is_running(m->procs[i])) {
+	break;
+      }
+    }
+    if(i == PROTECT_PROCESSES || m->procs[i] == NULL) {
+      if(elfloader_autostart_processes == m->autostart) {
+	elfloader_autostart_processes = NULL;
+      }
+      munmap(m->text, m->textsize);
+      munmap(m->data, m->datasize);
+      memset(m, 0, sizeof(struct module));
+      return m;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+int
+elfloader_arch_protect(struct process * const *processes)
+{
+  struct module *m;
+  int i;
+
+  for(i = 0; processes[i] != NULL; ++i);
+  m = free_module();
+  if(m == NULL || i > PROTECT_PROCESSES) {
+    return ELFLOADER_CANNOT_PROTECT;
+  }
+
+  init_fault_handler();
+
+  *m = loading;
+  memset(&loading, 0, sizeof(loading));
+  m->autostart = processes;
+  m->state = MODULE_LOADED;
+  for(i = 0; processes[i] != NULL; ++i) {
+    wrap(m, processes[i]);
+  }
+  return ELFLOADER_OK;
+}
+/*---------------------------------------------------------------------------*/
+void *
+elfloader_arch_symbol(void *addr)
+{
+  if(addr == (void *)process_start) {
+    return (void *)protected_start;
+  }
+  return addr;
+}
+/*---------------------------------------------------------------------------*/
+void *
+elfloader_arch_allocate_ram(int size)
+{
+  if(loading.data != NULL) {
+    /* The previous module failed to load. */
+    munmap(loading.data, loading.datasize);
+  }
+  loading.datasize = size;
+  loading.data = map_pages(&loading.datasize);
+  return loading.data;
+}
+/*---------------------------------------------------------------------------*/
+void *
+elfloader_arch_allocate_rom(int size)
+{
+  if(loading.text != NULL) {
+    munmap(loading.text, loading.textsize);
+  }
+  loading.textsize = size;
+  loading.text = map_pages(&loading.textsize);
+  return loading.text;
+}
+/*---------------------------------------------------------------------------*/
+void
+elfloader_arch_write_rom(int fd, unsigned short textoff, unsigned int size, char *mem)
+{
+  mprotect(loading.text, loading.textsize, PROT_READ | PROT_WRITE);
+  cfs_seek(fd, textoff, CFS_SEEK_SET);
+  cfs_read(fd, (unsigned char *)mem, size);
+  mprotect(loading.text, loading.textsize, PROT_READ | PROT_EXEC);
+}
+/*---------------------------------------------------------------------------*/
+void
+elfloader_arch_write_rom_buf(const char *buf, unsigned int size, char *mem)
+{
+  mprotect(loading.text, loading.textsize, PROT_READ | PROT_WRITE);
+  memcpy(mem, buf, size);
+  mprotect(loading.text, loading.textsize, PROT_READ | PROT_EXEC);
+}
+/*---------------------------------------------------------------------------*/
+
+#else /* ELFLOADER_PROTECT */
+
 static char datamemory[ELFLOADER_DATAMEMORY_SIZE];
 
 /*---------------------------------------------------------------------------*/
@@ -74,6 +433,14 @@ elfloader_arch_write_rom(int fd, unsigned short textoff, unsigned int size, char
 }
 /*---------------------------------------------------------------------------*/
 void
+elfloader_arch_write_rom_buf(const char *buf, unsigned int size, char *mem)
+{
+  memcpy(mem, buf, size);
+}
+
+#endif /* ELFLOADER_PROTECT */
+/*---------------------------------------------------------------------------*/
+void
 elfloader_arch_relocate(int fd, unsigned int sectionoffset, char *sectionaddress, 
 			struct elf32_rela *rela, char *addr)
 {
@@ -240,6 +240,9 @@ relocate_section(int fd,
       seek_read(fd, strtab + s.st_name, name, sizeof(name));
       PRINTF("name: %s\n", name);
       addr = (char *)symtab_lookup(name);
+#if ELFLOADER_PROTECT
+      addr = (char *)elfloader_arch_symbol(addr);
+#endif /* ELFLOADER_PROTECT */
       /* ADDED */
       if(addr == NULL) {
 	PRINTF("name not found in global: %s\n", name);
@@ -575,6 +578,12 @@ elfloader_load(int fd)
   process = (struct process **) find_local_symbol(fd, "autostart_processes", symtaboff, symtabsize, strtaboff);
   if(process != NULL) {
     PRINTF("elfloader: autostart found\n");
+#if ELFLOADER_PROTECT
+    ret = elfloader_arch_protect(process);
+    if(ret != ELFLOADER_OK) {
+      return ret;
+    }
+#endif /* ELFLOADER_PROTECT */
     elfloader_autostart_processes = process;
     return ELFLOADER_OK;
   } else {
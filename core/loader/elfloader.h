@@ -119,6 +119,12 @@
  * point could be found in the loaded module.
  */
 #define ELFLOADER_NO_STARTPOINT       7
+/**
+ * Return value from elfloader_load() indicating that the module could
+ * not be isolated (see ELFLOADER_PROTECT), because too many modules,
+ * or a module with too many processes, are loaded.
+ */
+#define ELFLOADER_CANNOT_PROTECT      13
 
 /**
  * elfloader initialization function.
@@ -175,6 +181,19 @@ extern char elfloader_unknown[30];
 #endif
 #endif /* ELFLOADER_TEXTMEMORY_SIZE */
 
+/**
+ * If set, each loaded module is given a protection domain of its own:
+ * its code is read-only, its data lies on pages of its own, and a
+ * memory fault inside one of its processes unloads the module instead
+ * of crashing the system. Only architectures with an MMU implement
+ * elfloader_arch_protect().
+ */
+#ifdef ELFLOADER_CONF_PROTECT
+#define ELFLOADER_PROTECT ELFLOADER_CONF_PROTECT
+#else
+#define ELFLOADER_PROTECT 0
+#endif
+
 typedef unsigned long  elf32_word;
 typedef   signed long  elf32_sword;
 typedef unsigned short elf32_half;
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Opportunistic anycast forwarding of upward traffic for
+ *         strobing radio duty cycling protocols
+ */
+
+#include "contiki.h"
+#include "net/mac/anycast.h"
+#include "net/netstack.h"
+#include "net/packetbuf.h"
+#include "lib/list.h"
+#include "lib/random.h"
+#include "sys/rtimer.h"
+
+#include <string.h>
+
+#define BACKOFF_SLOTS     4
+#define BACKOFF_SLOT_TIME (RTIMER_ARCH_SECOND / 2000)
+
+/* The X-MAC and CX-MAC headers both start with a dispatch byte and a
+   type byte. */
+#define RDC_HDR_LEN 2
+
+LIST(trees);
+
+/*---------------------------------------------------------------------------*/
+static struct anycast_parent *
+lookup(uint16_t id)
+{
+  struct anycast_parent *a;
+
+  for(a = list_head(trees); a != NULL; a = list_item_next(a)) {
+    if(a->id == id) {
+      return a;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+void
+anycast_register(struct anycast_parent *a, uint16_t id)
+{
+  a->id = id;
+  a->metric = ANYCAST_METRIC_NONE;
+  rimeaddr_copy(&a->parent, &rimeaddr_null);
+  rimeaddr_copy(&a->forwarder, &rimeaddr_null);
+  list_add(trees, a);
+}
+/*---------------------------------------------------------------------------*/
+void
+anycast_remove(struct anycast_parent *a)
+{
+  list_remove(trees, a);
+}
+/*---------------------------------------------------------------------------*/
+void
+anycast_set_parent(struct anycast_parent *a,
+                   const rimeaddr_t *p, uint16_t metric)
+{
+  if(p == NULL) {
+    p = &rimeaddr_null;
+  }
+  rimeaddr_copy(&a->parent, p);
+  a->metric = metric;
+}
+/*---------------------------------------------------------------------------*/
+uint16_t
+anycast_threshold(uint16_t id, const rimeaddr_t *receiver)
+{
+  struct anycast_parent *a;
+
+  a = lookup(id);
+  if(a == NULL || a->metric == ANYCAST_METRIC_NONE ||
+     rimeaddr_cmp(&a->parent, &rimeaddr_null) ||
+     !rimeaddr_cmp(&a->parent, receiver)) {
+    return ANYCAST_METRIC_NONE;
+  }
+  return a->metric;
+}
+/*---------------------------------------------------------------------------*/
+int
+anycast_create_strobe(uint8_t *strobe, int maxlen,
+                      uint8_t dispatch, uint8_t type, uint16_t threshold)
+{
+  uint8_t *hdr;
+  struct anycast_strobe *a;
+  rimeaddr_t receiver;
+  uint16_t id;
+
+  rimeaddr_copy(&receiver, packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
+  id = packetbuf_attr(PACKETBUF_ATTR_CHANNEL);
+
+  packetbuf_clear();
+  packetbuf_set_datalen(RDC_HDR_LEN + sizeof(struct anycast_strobe));
+  hdr = packetbuf_dataptr();
+  hdr[0] = dispatch;
+  hdr[1] = type;
+  a = (struct anycast_strobe *)&hdr[RDC_HDR_LEN];
+  a->id[0] = id & 0xff;
+  a->id[1] = id >> 8;
+  a->threshold[0] = threshold & 0xff;
+  a->threshold[1] = threshold >> 8;
+  rimeaddr_copy(&a->receiver, &receiver);
+
+  packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &rimeaddr_node_addr);
+  packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &rimeaddr_null);
+  if(NETSTACK_FRAMER.create() == 0 || packetbuf_totlen() > maxlen) {
+    return 0;
+  }
+  packetbuf_compact();
+  memcpy(strobe, packetbuf_hdrptr(), packetbuf_totlen());
+  return packetbuf_totlen();
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Wait a short random time and check that no other neighbor has
+ * started to acknowledge the strobe.
+ */
+static int
+contend(void)
+{
+  rtimer_clock_t wt;
+
+  wt = RTIMER_NOW() + (random_rand() % BACKOFF_SLOTS) * BACKOFF_SLOT_TIME;
+  while(RTIMER_CLOCK_LT(RTIMER_NOW(), wt)) { }
+
+  return NETSTACK_RADIO.channel_clear() &&
+    !NETSTACK_RADIO.receiving_packet() &&
+    !NETSTACK_RADIO.pending_packet();
+}
+/*---------------------------------------------------------------------------*/
+int
+anycast_input_strobe(uint8_t ack_type)
+{
+  struct anycast_strobe s;
+  struct anycast_parent *a;
+  uint8_t *hdr;
+
+  if(packetbuf_datalen() < RDC_HDR_LEN + sizeof(s)) {
+    return 0;
+  }
+  hdr = packetbuf_dataptr();
+  memcpy(&s, &hdr[RDC_HDR_LEN], sizeof(s));
+
+  if(!rimeaddr_cmp(&s.receiver, &rimeaddr_node_addr)) {
+    a = lookup(s.id[0] | (s.id[1] << 8));
+    if(a == NULL || a->metric == ANYCAST_METRIC_NONE ||
+       a->metric >= (s.threshold[0] | (s.threshold[1] << 8)) ||
+       !contend()) {
+      return 0;
+    }
+  }
+
+  /* Turn the strobe into a strobe ack to its sender. */
+  packetbuf_set_datalen(RDC_HDR_LEN);
+  hdr[1] = ack_type;
+  packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER,
+                     packetbuf_addr(PACKETBUF_ADDR_SENDER));
+  packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &rimeaddr_node_addr);
+  packetbuf_compact();
+  return NETSTACK_FRAMER.create();
+}
+/*---------------------------------------------------------------------------*/
+void
+anycast_set_forwarder(uint16_t id, const rimeaddr_t *f)
+{
+  struct anycast_parent *a;
+
+  a = lookup(id);
+  if(a != NULL) {
+    rimeaddr_copy(&a->forwarder, f);
+  }
+}
+/*---------------------------------------------------------------------------*/
+const rimeaddr_t *
+anycast_forwarder(struct anycast_parent *a)
+{
+  return &a->forwarder;
+}
+/*---------------------------------------------------------------------------*/
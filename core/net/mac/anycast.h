@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Opportunistic anycast forwarding of upward traffic for
+ *         strobing radio duty cycling protocols
+ */
+
+#ifndef ANYCAST_H
+#define ANYCAST_H
+
+#include "net/rime/rimeaddr.h"
+
+/* A routing metric that never lets a node take over a packet. */
+#define ANYCAST_METRIC_NONE 0xffff
+
+/* The payload of an anycast strobe, which follows the dispatch and
+   type bytes of the RDC header. Anycast strobes are sent to the
+   broadcast address so that every awake neighbor hears them. The id
+   names the routing tree the packet travels in, so that only nodes in
+   the same tree can take it over. */
+struct anycast_strobe {
+  uint8_t id[2];
+  uint8_t threshold[2];
+  rimeaddr_t receiver;
+};
+
+/* The parent and metric of one routing tree. */
+struct anycast_parent {
+  struct anycast_parent *next;
+  uint16_t id;
+  uint16_t metric;
+  rimeaddr_t parent;
+  rimeaddr_t forwarder;
+};
+
+/**
+ * \brief      Register a routing tree for anycast forwarding
+ * \param a    A pointer to a struct anycast_parent
+ * \param id   The Rime channel that the tree sends its data packets on
+ *
+ *             Called by Collect when a connection is opened. The
+ *             tree has no parent until anycast_set_parent() is
+ *             called. Only Rime protocols can use anycast: the data
+ *             packet is re-addressed to the neighbor that takes it
+ *             over, and header compression such as 6LoWPAN derives
+ *             network layer addresses from the link-layer receiver.
+ */
+void anycast_register(struct anycast_parent *a, uint16_t id);
+
+/**
+ * \brief      Remove a routing tree registered with anycast_register()
+ */
+void anycast_remove(struct anycast_parent *a);
+
+/**
+ * \brief      Set the parent of a routing tree
+ * \param a    The tree
+ * \param parent The neighbor that upward traffic is sent to
+ * \param metric Our own routing metric, lower is closer to the sink
+ *
+ *             Called whenever the parent or metric of the tree
+ *             changes. Unicast packets sent to the parent on the
+ *             channel of the tree are strobed as anycast packets that
+ *             any awake neighbor in the same tree with a metric lower
+ *             than ours may take over. A metric of
+ *             ANYCAST_METRIC_NONE turns anycast off for the tree.
+ */
+void anycast_set_parent(struct anycast_parent *a,
+                        const rimeaddr_t *parent, uint16_t metric);
+
+/**
+ * \brief      Get the anycast threshold for a packet
+ * \param id   The Rime channel of the packet
+ * \param receiver The link-layer receiver of the packet
+ * \return     Our metric if the packet goes to the parent of the tree, ANYCAST_METRIC_NONE otherwise
+ */
+uint16_t anycast_threshold(uint16_t id, const rimeaddr_t *receiver);
+
+/**
+ * \brief      Build an anycast strobe for the packet in the packetbuf
+ * \param strobe The buffer to build the strobe in
+ * \param maxlen The size of the buffer
+ * \param dispatch The dispatch byte of the RDC header
+ * \param type The type byte of the RDC header
+ * \param threshold The threshold returned by anycast_threshold()
+ * \return     The length of the strobe, or 0 if it does not fit
+ *
+ *             The strobe is sent to the broadcast address so that
+ *             any awake neighbor with a metric below the threshold
+ *             can acknowledge it. This overwrites the packetbuf.
+ */
+int anycast_create_strobe(uint8_t *strobe, int maxlen,
+                          uint8_t dispatch, uint8_t type,
+                          uint16_t threshold);
+
+/**
+ * \brief      Decide whether to acknowledge the anycast strobe in the packetbuf
+ * \param ack_type The type byte of a strobe ACK in the RDC header
+ * \return     Non-zero if the packetbuf now holds a strobe ACK to send
+ *
+ *             The parent always acknowledges the strobe. Other
+ *             neighbors only take over the packet if they are in the
+ *             same tree, are closer to the sink, and no one else has
+ *             acknowledged the strobe after a short random
+ *             backoff. Because a node only takes over packets from
+ *             nodes with a higher metric, anycast forwarding cannot
+ *             loop.
+ */
+int anycast_input_strobe(uint8_t ack_type);
+
+/**
+ * \brief      Record the neighbor that took over the last anycast packet
+ * \param id   The Rime channel of the packet
+ * \param forwarder The neighbor, or rimeaddr_null if the parent received it
+ */
+void anycast_set_forwarder(uint16_t id, const rimeaddr_t *forwarder);
+
+/**
+ * \brief      Get the neighbor that took over the last anycast packet of a tree
+ *
+ *             Routing protocols with hop-by-hop acknowledgements use
+ *             this to accept an acknowledgement from a neighbor
+ *             other than their parent.
+ */
+const rimeaddr_t *anycast_forwarder(struct anycast_parent *a);
+
+#endif /* ANYCAST_H */
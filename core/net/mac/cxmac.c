@@ -46,6 +46,7 @@
 #include "net/netstack.h"
 #include "lib/random.h"
 #include "net/mac/cxmac.h"
+#include "net/mac/anycast.h"
 #include "net/rime.h"
 #include "net/rime/timesynch.h"
 #include "sys/compower.h"
@@ -72,6 +73,11 @@
 #ifndef WITH_STROBE_BROADCAST
 #define WITH_STROBE_BROADCAST        0
 #endif
+#ifdef CXMAC_CONF_WITH_ANYCAST
+#define WITH_ANYCAST                 CXMAC_CONF_WITH_ANYCAST
+#else
+#define WITH_ANYCAST                 0
+#endif
 
 struct announcement_data {
   uint16_t id;
@@ -97,6 +103,7 @@ struct announcement_msg {
 /* #define TYPE_DATA         0x11 */
 #define TYPE_ANNOUNCEMENT 0x12
 #define TYPE_STROBE_ACK   0x13
+#define TYPE_ANYCAST_STROBE 0x14
 
 struct cxmac_hdr {
   uint8_t dispatch;
@@ -426,6 +433,11 @@ send_packet(void)
   struct queuebuf *packet;
   int is_already_streaming = 0;
   uint8_t collisions;
+#if WITH_ANYCAST
+  int hdrlen;
+  uint16_t threshold = ANYCAST_METRIC_NONE;
+  rimeaddr_t acker;
+#endif /* WITH_ANYCAST */
 
 
   /* Create the X-MAC header for the data packet. */
@@ -456,6 +468,9 @@ send_packet(void)
   is_reliable = packetbuf_attr(PACKETBUF_ATTR_RELIABLE) ||
     packetbuf_attr(PACKETBUF_ATTR_ERELIABLE);
   len = NETSTACK_FRAMER.create();
+#if WITH_ANYCAST
+  hdrlen = len;
+#endif /* WITH_ANYCAST */
   strobe_len = len + sizeof(struct cxmac_hdr);
   if(len == 0 || strobe_len > (int)sizeof(strobe)) {
     /* Failed to send */
@@ -536,6 +551,25 @@ send_packet(void)
   }
 #endif /* WITH_ENCOUNTER_OPTIMIZATION */
 
+#if WITH_ANYCAST
+  /* Upward packets to our routing parent are strobed as anycast
+     packets, which the first awake neighbor closer to the sink may
+     take over. */
+  if(!is_broadcast && !is_already_streaming) {
+    threshold = anycast_threshold(packetbuf_attr(PACKETBUF_ATTR_CHANNEL),
+                                  packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
+    if(threshold != ANYCAST_METRIC_NONE) {
+      strobe_len = anycast_create_strobe(strobe, sizeof(strobe), DISPATCH,
+                                         TYPE_ANYCAST_STROBE, threshold);
+      if(strobe_len == 0) {
+        PRINTF("cxmac: failed to create anycast strobe\n");
+        queuebuf_free(packet);
+        return MAC_TX_ERR_FATAL;
+      }
+    }
+  }
+#endif /* WITH_ANYCAST */
+
   /* By setting we_are_sending to one, we ensure that the rtimer
      powercycle interrupt do not interfere with us sending the packet. */
   we_are_sending = 1;
@@ -577,6 +611,9 @@ send_packet(void)
 		   the packet. */
 		got_strobe_ack = 1;
 		encounter_time = now;
+#if WITH_ANYCAST
+		rimeaddr_copy(&acker, packetbuf_addr(PACKETBUF_ADDR_SENDER));
+#endif /* WITH_ANYCAST */
 	      } else {
 		PRINTDEBUG("cxmac: strobe ack for someone else\n");
 	      }
@@ -639,6 +676,27 @@ send_packet(void)
   queuebuf_to_packetbuf(packet);
   queuebuf_free(packet);
 
+#if WITH_ANYCAST
+  if(threshold != ANYCAST_METRIC_NONE && got_strobe_ack) {
+    if(rimeaddr_cmp(&acker, packetbuf_addr(PACKETBUF_ADDR_RECEIVER))) {
+      anycast_set_forwarder(packetbuf_attr(PACKETBUF_ATTR_CHANNEL),
+                            &rimeaddr_null);
+    } else {
+      /* Another neighbor took over the packet, so we address the data
+         packet to that neighbor instead of to our parent. */
+      packetbuf_hdrreduce(hdrlen);
+      packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &acker);
+      if(NETSTACK_FRAMER.create() == 0) {
+        got_strobe_ack = 0;
+      } else {
+        packetbuf_compact();
+        anycast_set_forwarder(packetbuf_attr(PACKETBUF_ATTR_CHANNEL),
+                              &acker);
+      }
+    }
+  }
+#endif /* WITH_ANYCAST */
+
   /* Send the data packet. */
   if((is_broadcast || got_strobe_ack || is_streaming) && collisions == 0) {
     NETSTACK_RADIO.send(packetbuf_hdrptr(), packetbuf_totlen());
@@ -788,6 +846,21 @@ input_packet(void)
       /* We are done processing the strobe and we therefore return
 	 to the caller. */
       return;
+#if WITH_ANYCAST
+    } else if(hdr->type == TYPE_ANYCAST_STROBE) {
+      someone_is_sending = 2;
+
+      if(anycast_input_strobe(TYPE_STROBE_ACK)) {
+        /* We turn on the radio in anticipation of the incoming
+           packet. */
+        someone_is_sending = 1;
+        waiting_for_packet = 1;
+        on();
+        NETSTACK_RADIO.send(packetbuf_hdrptr(), packetbuf_totlen());
+        PRINTDEBUG("cxmac: send anycast strobe ack %u\n", packetbuf_totlen());
+      }
+      return;
+#endif /* WITH_ANYCAST */
 #if CXMAC_CONF_ANNOUNCEMENTS
     } else if(hdr->type == TYPE_ANNOUNCEMENT) {
       packetbuf_hdrreduce(sizeof(struct cxmac_hdr));
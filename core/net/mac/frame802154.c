@@ -92,6 +92,28 @@ addr_len(uint8_t mode)
   }
 }
 /*----------------------------------------------------------------------------*/
+/* Copy an address from the frame, where it is stored least
+   significant byte first, unrolled since this is done for every
+   received frame. */
+CC_INLINE static void
+parse_addr(uint8_t mode, uint8_t *addr, const uint8_t *p)
+{
+  if(mode == FRAME802154_SHORTADDRMODE) {
+    addr[0] = p[1];
+    addr[1] = p[0];
+    memset(addr + 2, 0, 6);
+  } else {
+    addr[0] = p[7];
+    addr[1] = p[6];
+    addr[2] = p[5];
+    addr[3] = p[4];
+    addr[4] = p[3];
+    addr[5] = p[2];
+    addr[6] = p[1];
+    addr[7] = p[0];
+  }
+}
+/*----------------------------------------------------------------------------*/
 static void
 field_len(frame802154_t *p, field_length_t *flen)
 {
@@ -285,21 +307,12 @@ frame802154_parse(uint8_t *data, uint8_t len, frame802154_t *pf)
     p += 2;
 
     /* Destination address */
-/*     l = addr_len(fcf.dest_addr_mode); */
-/*     for(c = 0; c < l; c++) { */
-/*       pf->dest_addr.u8[c] = p[l - c - 1]; */
-/*     } */
-/*     p += l; */
-    if(fcf.dest_addr_mode == FRAME802154_SHORTADDRMODE) {
+    c = addr_len(fcf.dest_addr_mode);
+    if(c == 0) {
       rimeaddr_copy((rimeaddr_t *)&(pf->dest_addr), &rimeaddr_null);
-      pf->dest_addr[0] = p[1];
-      pf->dest_addr[1] = p[0];
-      p += 2;
-    } else if(fcf.dest_addr_mode == FRAME802154_LONGADDRMODE) {
-      for(c = 0; c < 8; c++) {
-        pf->dest_addr[c] = p[7 - c];
-      }
-      p += 8;
+    } else {
+      parse_addr(fcf.dest_addr_mode, pf->dest_addr, p);
+      p += c;
     }
   } else {
     rimeaddr_copy((rimeaddr_t *)&(pf->dest_addr), &rimeaddr_null);
@@ -317,21 +330,12 @@ frame802154_parse(uint8_t *data, uint8_t len, frame802154_t *pf)
     }
 
     /* Source address */
-/*     l = addr_len(fcf.src_addr_mode); */
-/*     for(c = 0; c < l; c++) { */
-/*       pf->src_addr.u8[c] = p[l - c - 1]; */
-/*     } */
-/*     p += l; */
-    if(fcf.src_addr_mode == FRAME802154_SHORTADDRMODE) {
+    c = addr_len(fcf.src_addr_mode);
+    if(c == 0) {
       rimeaddr_copy((rimeaddr_t *)&(pf->src_addr), &rimeaddr_null);
-      pf->src_addr[0] = p[1];
-      pf->src_addr[1] = p[0];
-      p += 2;
-    } else if(fcf.src_addr_mode == FRAME802154_LONGADDRMODE) {
-      for(c = 0; c < 8; c++) {
-        pf->src_addr[c] = p[7 - c];
-      }
-      p += 8;
+    } else {
+      parse_addr(fcf.src_addr_mode, pf->src_addr, p);
+      p += c;
     }
   } else {
     rimeaddr_copy((rimeaddr_t *)&(pf->src_addr), &rimeaddr_null);
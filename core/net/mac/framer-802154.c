@@ -59,6 +59,35 @@ static uint8_t initialized = 0;
 static const uint16_t mac_dst_pan_id = IEEE802154_PANID;
 static const uint16_t mac_src_pan_id = IEEE802154_PANID;
 
+/* The number of recently used frame headers that are kept as
+   templates. A frame to a destination that has a template only
+   needs a copy of the template and a new sequence number. */
+#ifdef FRAMER_802154_CONF_HEADER_CACHE_SIZE
+#define HEADER_CACHE_SIZE FRAMER_802154_CONF_HEADER_CACHE_SIZE
+#else /* FRAMER_802154_CONF_HEADER_CACHE_SIZE */
+#define HEADER_CACHE_SIZE 2
+#endif /* FRAMER_802154_CONF_HEADER_CACHE_SIZE */
+
+#if HEADER_CACHE_SIZE > 0
+/* FCF, sequence number, two PAN IDs and two long addresses. */
+#define MAX_HDR_LEN 23
+
+#define TEMPLATE_PENDING 0x01
+#define TEMPLATE_ACK     0x02
+#define TEMPLATE_USED    0x80
+
+struct header_template {
+  rimeaddr_t receiver;
+  uint8_t flags;
+  uint8_t len;
+  uint8_t hdr[MAX_HDR_LEN];
+};
+
+static struct header_template templates[HEADER_CACHE_SIZE];
+static uint8_t next_template;
+static rimeaddr_t template_sender;
+#endif /* HEADER_CACHE_SIZE > 0 */
+
 /*---------------------------------------------------------------------------*/
 static int
 is_broadcast_addr(uint8_t mode, uint8_t *addr)
@@ -71,44 +100,111 @@ is_broadcast_addr(uint8_t mode, uint8_t *addr)
   }
   return 1;
 }
+#if HEADER_CACHE_SIZE > 0
+/*---------------------------------------------------------------------------*/
+static struct header_template *
+template_lookup(const rimeaddr_t *receiver, uint8_t flags)
+{
+  struct header_template *t;
+
+  /* The templates contain our own address, so they are all stale if
+     it has been changed. */
+  if(!rimeaddr_cmp(&template_sender, &rimeaddr_node_addr)) {
+    memset(templates, 0, sizeof(templates));
+    rimeaddr_copy(&template_sender, &rimeaddr_node_addr);
+    return NULL;
+  }
+
+  for(t = templates; t < &templates[HEADER_CACHE_SIZE]; t++) {
+    if(t->flags == flags && rimeaddr_cmp(&t->receiver, receiver)) {
+      return t;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+template_add(const rimeaddr_t *receiver, uint8_t flags,
+             const uint8_t *hdr, uint8_t len)
+{
+  struct header_template *t;
+
+  if(len > MAX_HDR_LEN) {
+    return;
+  }
+  t = &templates[next_template];
+  next_template = (next_template + 1) % HEADER_CACHE_SIZE;
+  rimeaddr_copy(&t->receiver, receiver);
+  t->flags = flags;
+  t->len = len;
+  memcpy(t->hdr, hdr, len);
+}
+#endif /* HEADER_CACHE_SIZE > 0 */
 /*---------------------------------------------------------------------------*/
 static int
 create(void)
 {
   frame802154_t params;
+  const rimeaddr_t *receiver;
+  uint8_t pending, ack, seq;
   uint8_t len;
-
-  /* init to zeros */
-  memset(&params, 0, sizeof(params));
+#if HEADER_CACHE_SIZE > 0
+  struct header_template *t;
+  uint8_t flags;
+#endif /* HEADER_CACHE_SIZE > 0 */
 
   if(!initialized) {
     initialized = 1;
     mac_dsn = random_rand() & 0xff;
   }
 
-  /* Build the FCF. */
-  params.fcf.frame_type = FRAME802154_DATAFRAME;
-  params.fcf.security_enabled = 0;
-  params.fcf.frame_pending = packetbuf_attr(PACKETBUF_ATTR_PENDING);
-  if(rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER), &rimeaddr_null)) {
-    params.fcf.ack_required = 0;
+  receiver = packetbuf_addr(PACKETBUF_ADDR_RECEIVER);
+  pending = packetbuf_attr(PACKETBUF_ATTR_PENDING) ? 1 : 0;
+  if(rimeaddr_cmp(receiver, &rimeaddr_null)) {
+    ack = 0;
   } else {
-    params.fcf.ack_required = packetbuf_attr(PACKETBUF_ATTR_MAC_ACK);
+    ack = packetbuf_attr(PACKETBUF_ATTR_MAC_ACK) ? 1 : 0;
   }
-  params.fcf.panid_compression = 0;
-
-  /* Insert IEEE 802.15.4 (2003) version bit. */
-  params.fcf.frame_version = FRAME802154_IEEE802154_2003;
 
   /* Increment and set the data sequence number. */
   if(packetbuf_attr(PACKETBUF_ATTR_MAC_SEQNO)) {
-    params.seq = packetbuf_attr(PACKETBUF_ATTR_MAC_SEQNO);
+    seq = packetbuf_attr(PACKETBUF_ATTR_MAC_SEQNO);
   } else {
-    params.seq = mac_dsn++;
-    packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, params.seq);
+    seq = mac_dsn++;
+    packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, seq);
   }
 /*   params.seq = packetbuf_attr(PACKETBUF_ATTR_PACKET_ID); */
 
+#if HEADER_CACHE_SIZE > 0
+  flags = TEMPLATE_USED | (pending ? TEMPLATE_PENDING : 0) |
+    (ack ? TEMPLATE_ACK : 0);
+  t = template_lookup(receiver, flags);
+  if(t != NULL) {
+    if(packetbuf_hdralloc(t->len)) {
+      memcpy(packetbuf_hdrptr(), t->hdr, t->len);
+      ((uint8_t *)packetbuf_hdrptr())[2] = seq;
+      return t->len;
+    }
+    PRINTF("15.4-OUT: too large header: %u\n", t->len);
+    return 0;
+  }
+#endif /* HEADER_CACHE_SIZE > 0 */
+
+  /* init to zeros */
+  memset(&params, 0, sizeof(params));
+
+  /* Build the FCF. */
+  params.fcf.frame_type = FRAME802154_DATAFRAME;
+  params.fcf.security_enabled = 0;
+  params.fcf.frame_pending = pending;
+  params.fcf.ack_required = ack;
+  params.fcf.panid_compression = 0;
+
+  /* Insert IEEE 802.15.4 (2003) version bit. */
+  params.fcf.frame_version = FRAME802154_IEEE802154_2003;
+
+  params.seq = seq;
+
   /* Complete the addressing fields. */
   /**
      \todo For phase 1 the addresses are all long. We'll need a mechanism
@@ -126,15 +222,14 @@ create(void)
    *  If the output address is NULL in the Rime buf, then it is broadcast
    *  on the 802.15.4 network.
    */
-  if(rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER), &rimeaddr_null)) {
+  if(rimeaddr_cmp(receiver, &rimeaddr_null)) {
     /* Broadcast requires short address mode. */
     params.fcf.dest_addr_mode = FRAME802154_SHORTADDRMODE;
     params.dest_addr[0] = 0xFF;
     params.dest_addr[1] = 0xFF;
 
   } else {
-    rimeaddr_copy((rimeaddr_t *)&params.dest_addr,
-                  packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
+    rimeaddr_copy((rimeaddr_t *)&params.dest_addr, receiver);
     /* Use short address mode if rimeaddr size is small */
     if(sizeof(rimeaddr_t) == 2) {
       params.fcf.dest_addr_mode = FRAME802154_SHORTADDRMODE;
@@ -157,6 +252,9 @@ create(void)
   len = frame802154_hdrlen(&params);
   if(packetbuf_hdralloc(len)) {
     frame802154_create(&params, packetbuf_hdrptr(), len);
+#if HEADER_CACHE_SIZE > 0
+    template_add(receiver, flags, packetbuf_hdrptr(), len);
+#endif /* HEADER_CACHE_SIZE > 0 */
 
     PRINTF("15.4-OUT: %2X", params.fcf.frame_type);
     PRINTADDR(params.dest_addr.u8);
@@ -48,6 +48,17 @@
  * probe. To send a packet, the sending node turns on its radio to
  * listen for probe packets.
  *
+ * With LPP_CONF_WITH_PHASE_OPTIMIZATION, the time at which each
+ * neighbor sends its probes is recorded with the phase module. A
+ * sender then keeps its radio off until just before the probe of the
+ * receiver, instead of listening for up to a full probe period.
+ *
+ * With LPP_CONF_WITH_PROBE_AGGREGATION, a node that receives a
+ * unicast data packet after its probe immediately sends a follow-up
+ * probe. Senders that heard the same probe contend for it with a
+ * short random backoff, and those that lose stay awake and are served
+ * by the follow-up probe rather than having to wait a full cycle.
+ *
  */
 
 #include "dev/leds.h"
@@ -82,6 +93,25 @@
 #define WITH_PENDING_BROADCAST        0
 #define WITH_STREAMING                1
 
+#ifdef LPP_CONF_WITH_PHASE_OPTIMIZATION
+#define WITH_PHASE_OPTIMIZATION       LPP_CONF_WITH_PHASE_OPTIMIZATION
+#else /* LPP_CONF_WITH_PHASE_OPTIMIZATION */
+#define WITH_PHASE_OPTIMIZATION       0
+#endif /* LPP_CONF_WITH_PHASE_OPTIMIZATION */
+
+#ifdef LPP_CONF_WITH_PROBE_AGGREGATION
+#define WITH_PROBE_AGGREGATION        LPP_CONF_WITH_PROBE_AGGREGATION
+#else /* LPP_CONF_WITH_PROBE_AGGREGATION */
+#define WITH_PROBE_AGGREGATION        0
+#endif /* LPP_CONF_WITH_PROBE_AGGREGATION */
+
+/* The guard time below does not leave any sleep time at high probe
+   rates, so we only do phase optimization for slow duty cycles. */
+#if NETSTACK_RDC_CHANNEL_CHECK_RATE >= 32
+#undef WITH_PHASE_OPTIMIZATION
+#define WITH_PHASE_OPTIMIZATION       0
+#endif
+
 #define LISTEN_TIME (CLOCK_SECOND / 128)
 #define OFF_TIME (CLOCK_SECOND / NETSTACK_RDC_CHANNEL_CHECK_RATE - LISTEN_TIME)
 
@@ -124,6 +154,7 @@ struct announcement_msg {
 
 #define TYPE_PROBE        1
 #define TYPE_DATA         2
+#define TYPE_FOLLOWUP_PROBE 3
 struct lpp_hdr {
   uint16_t type;
   rimeaddr_t sender;
@@ -182,6 +213,40 @@ static struct ctimer stream_probe_timer, stream_off_timer;
 #define STREAM_OFF_TIME CLOCK_SECOND / 2
 #endif /* WITH_STREAMING */
 
+#if WITH_PHASE_OPTIMIZATION
+
+#include "net/mac/phase.h"
+
+/* The probe period in rtimer ticks. The phase module requires this
+   to be a power of two. */
+#define CYCLE_TIME (RTIMER_ARCH_SECOND / NETSTACK_RDC_CHANNEL_CHECK_RATE)
+
+/* Probes are scheduled with a ctimer, so they jitter by a few clock
+   ticks. We turn on the radio GUARD_TIME before the expected probe. */
+#define GUARD_TIME (4 * RTIMER_ARCH_SECOND / CLOCK_SECOND)
+
+#ifndef MAX_PHASE_NEIGHBORS
+#define MAX_PHASE_NEIGHBORS 16
+#endif
+
+PHASE_LIST(lpp_phase_list, MAX_PHASE_NEIGHBORS);
+
+#endif /* WITH_PHASE_OPTIMIZATION */
+
+#if WITH_PROBE_AGGREGATION
+/* Senders that heard the same probe pick one of AGGREGATION_SLOTS
+   backoff slots before checking the channel and transmitting. */
+#define AGGREGATION_SLOTS     4
+#define AGGREGATION_SLOT_TIME (RTIMER_ARCH_SECOND / 2000)
+
+/* The maximum number of follow-up probes sent after one regular
+   probe. */
+#define MAX_FOLLOWUP_PROBES   4
+
+static struct ctimer followup_timer;
+static uint8_t followup_probes;
+#endif /* WITH_PROBE_AGGREGATION */
+
 #ifndef MIN
 #define MIN(a, b) ((a) < (b)? (a) : (b))
 #endif /* MIN */
@@ -382,6 +447,17 @@ remove_queued_packet(struct queue_list_item *i, uint8_t tx_ok)
   } else {
     status = MAC_TX_OK;
   }
+#if WITH_PHASE_OPTIMIZATION
+  /* Successful transmissions have already updated the phase when the
+     probe was received. A neighbor that does not answer may have
+     rebooted and changed its phase, which the phase module handles
+     by eventually dropping it. */
+  if(status == MAC_TX_NOACK &&
+     !rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER), &rimeaddr_null)) {
+    phase_update(&lpp_phase_list, packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
+                 0, MAC_TX_NOACK);
+  }
+#endif /* WITH_PHASE_OPTIMIZATION */
   mac_call_sent_callback(sent, ptr, status, num_transmissions);
 }
 /*---------------------------------------------------------------------------*/
@@ -416,10 +492,10 @@ listen_callback(int periods)
 }
 /*---------------------------------------------------------------------------*/
 /**
- * Send a probe packet.
+ * Send a probe packet of the given type.
  */
 static void
-send_probe(void)
+send_probe(uint16_t type)
 {
   struct lpp_hdr *hdr;
   struct announcement_msg *adata;
@@ -429,7 +505,7 @@ send_probe(void)
   packetbuf_clear();
   packetbuf_set_datalen(sizeof(struct lpp_hdr));
   hdr = packetbuf_dataptr();
-  hdr->type = TYPE_PROBE;
+  hdr->type = type;
   rimeaddr_copy(&hdr->sender, &rimeaddr_node_addr);
   /*  rimeaddr_copy(&hdr->receiver, packetbuf_addr(PACKETBUF_ADDR_RECEIVER));*/
   rimeaddr_copy(&hdr->receiver, &rimeaddr_null);
@@ -478,7 +554,7 @@ send_stream_probe(void *dummy)
   turn_radio_on();
   
   /* Send a probe packet. */
-  send_probe();
+  send_probe(TYPE_PROBE);
 
 #if WITH_STREAMING
   is_streaming = 1;
@@ -503,6 +579,48 @@ num_packets_to_send(void)
   return list_length(queued_packets_list);
 #endif /* WITH_PENDING_BROADCAST */
 }
+#if WITH_PROBE_AGGREGATION
+/*---------------------------------------------------------------------------*/
+static void
+followup_off(void *dummy)
+{
+  if(num_packets_to_send() == 0 && is_listening == 0 &&
+     !NETSTACK_RADIO.receiving_packet()) {
+    turn_radio_off();
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Send a follow-up probe after a data packet was received, and keep
+ * the radio on for another LISTEN_TIME so that other senders that
+ * were waiting for our probe can transmit.
+ */
+static void
+send_followup_probe(void)
+{
+  turn_radio_on();
+  send_probe(TYPE_FOLLOWUP_PROBE);
+  ctimer_set(&followup_timer, LISTEN_TIME, followup_off, NULL);
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Wait for a random backoff slot after a probe and check if the
+ * channel is still clear. Returns zero if another sender already
+ * transmits in response to the same probe.
+ */
+static int
+contend_for_probe(void)
+{
+  rtimer_clock_t wt;
+
+  wt = RTIMER_NOW() + (random_rand() % AGGREGATION_SLOTS) * AGGREGATION_SLOT_TIME;
+  while(RTIMER_CLOCK_LT(RTIMER_NOW(), wt)) { }
+
+  return NETSTACK_RADIO.channel_clear() &&
+    !NETSTACK_RADIO.receiving_packet() &&
+    !NETSTACK_RADIO.pending_packet();
+}
+#endif /* WITH_PROBE_AGGREGATION */
 /*---------------------------------------------------------------------------*/
 /**
  * Duty cycle the radio and send probes. This function is called
@@ -538,7 +656,10 @@ dutycycle(void *ptr)
     turn_radio_on();
 
     /* Send a probe packet. */
-    send_probe();
+    send_probe(TYPE_PROBE);
+#if WITH_PROBE_AGGREGATION
+    followup_probes = 0;
+#endif /* WITH_PROBE_AGGREGATION */
 
     /* Set a timer so that we keep the radio on for LISTEN_TIME. */
     ctimer_set(t, LISTEN_TIME, (void (*)(void *))dutycycle, t);
@@ -571,7 +692,11 @@ dutycycle(void *ptr)
 	 off and wait until we send the next probe. */
       if(is_listening == 0) {
         int current_off_time;
-        if(!NETSTACK_RADIO.receiving_packet()) {
+        if(!NETSTACK_RADIO.receiving_packet()
+#if WITH_PROBE_AGGREGATION
+           && ctimer_expired(&followup_timer)
+#endif /* WITH_PROBE_AGGREGATION */
+           ) {
           turn_radio_off();
           compower_accumulate(&compower_idle_activity);
         }
@@ -641,6 +766,21 @@ send_packet(mac_callback_t sent, void *ptr)
   if(rimeaddr_cmp(&hdr.receiver, &rimeaddr_null)) {
     is_broadcast = 1;
   }
+
+#if WITH_PHASE_OPTIMIZATION
+  /* If we know when the receiver sends its probes, we defer the
+     packet until just before the next probe instead of keeping the
+     radio on while waiting for it. The phase module calls us again
+     when it is time to send. */
+  if(!is_broadcast &&
+     packetbuf_attr(PACKETBUF_ATTR_PACKET_TYPE) !=
+     PACKETBUF_ATTR_PACKET_TYPE_STREAM) {
+    if(phase_wait(&lpp_phase_list, &hdr.receiver, CYCLE_TIME, GUARD_TIME,
+                  sent, ptr) == PHASE_DEFERRED) {
+      return;
+    }
+  }
+#endif /* WITH_PHASE_OPTIMIZATION */
   hdr.type = TYPE_DATA;
 
   packetbuf_hdralloc(sizeof(struct lpp_hdr));
@@ -771,6 +911,11 @@ input_packet(void)
 {
   struct lpp_hdr hdr;
   clock_time_t reception_time;
+#if WITH_PHASE_OPTIMIZATION
+  rtimer_clock_t probe_time;
+
+  probe_time = RTIMER_NOW();
+#endif /* WITH_PHASE_OPTIMIZATION */
 
   reception_time = clock_time();
 
@@ -782,13 +927,24 @@ input_packet(void)
   packetbuf_hdrreduce(sizeof(struct lpp_hdr));
   /*    PRINTF("got packet type %d\n", hdr->type);*/
 
-  if(hdr.type == TYPE_PROBE) {
+  if(hdr.type == TYPE_PROBE || hdr.type == TYPE_FOLLOWUP_PROBE) {
     struct announcement_msg adata;
+#if WITH_PROBE_AGGREGATION
+    uint8_t contended = 0;
+#endif /* WITH_PROBE_AGGREGATION */
     
     /* Register the encounter with the sending node. We now know the
        neighbor's phase. */
     register_encounter(&hdr.sender, reception_time);
 
+#if WITH_PHASE_OPTIMIZATION
+    /* Only regular probes follow the duty cycle of the neighbor;
+       follow-up probes are sent whenever a packet was received. */
+    if(hdr.type == TYPE_PROBE) {
+      phase_update(&lpp_phase_list, &hdr.sender, probe_time, MAC_TX_OK);
+    }
+#endif /* WITH_PHASE_OPTIMIZATION */
+
     /* Parse incoming announcements */
     memcpy(&adata, packetbuf_dataptr(),
            MIN(packetbuf_datalen(), sizeof(adata)));
@@ -829,6 +985,21 @@ input_packet(void)
         receiver = queuebuf_addr(i->packet, PACKETBUF_ADDR_RECEIVER);
         if(rimeaddr_cmp(receiver, &hdr.sender) ||
            rimeaddr_cmp(receiver, &rimeaddr_null)) {
+
+#if WITH_PROBE_AGGREGATION
+          /* Other senders may have heard the same probe. If one of
+             them wins the channel, we keep our unicast packets and
+             the radio on, and send them after the follow-up probe. */
+          if(!rimeaddr_cmp(receiver, &rimeaddr_null)) {
+            if(contended == 0) {
+              contended = contend_for_probe() ? 1 : 2;
+            }
+            if(contended == 2) {
+              continue;
+            }
+          }
+#endif /* WITH_PROBE_AGGREGATION */
+
           queuebuf_to_packetbuf(i->packet);
 
 #if WITH_PENDING_BROADCAST
@@ -906,7 +1077,15 @@ input_packet(void)
     }
 
   } else if(hdr.type == TYPE_DATA) {
+#if WITH_PROBE_AGGREGATION
+    /* A sender that lost the contention for a probe stays awake for
+       the follow-up probe. */
+    if(num_packets_to_send() == 0) {
+      turn_radio_off();
+    }
+#else /* WITH_PROBE_AGGREGATION */
     turn_radio_off();
+#endif /* WITH_PROBE_AGGREGATION */
     if(!rimeaddr_cmp(&hdr.receiver, &rimeaddr_null)) {
       if(!rimeaddr_cmp(&hdr.receiver, &rimeaddr_node_addr)) {
         /* Not broadcast or for us */
@@ -964,7 +1143,7 @@ input_packet(void)
       struct queuebuf *q;
       q = queuebuf_new_from_packetbuf();
       if(q != NULL) {
-        send_probe();
+        send_probe(TYPE_PROBE);
         queuebuf_to_packetbuf(q);
         queuebuf_free(q);
       }
@@ -977,6 +1156,15 @@ input_packet(void)
 #endif /* WITH_ADAPTIVE_OFF_TIME */
 
     NETSTACK_MAC.input();
+
+#if WITH_PROBE_AGGREGATION
+    /* Serve any other senders that were waiting for our probe. */
+    if(rimeaddr_cmp(&hdr.receiver, &rimeaddr_node_addr) &&
+       followup_probes < MAX_FOLLOWUP_PROBES) {
+      ++followup_probes;
+      send_followup_probe();
+    }
+#endif /* WITH_PROBE_AGGREGATION */
   }
 }
 /*---------------------------------------------------------------------------*/
@@ -1018,6 +1206,10 @@ init(void)
   memb_init(&queued_packets_memb);
   list_init(queued_packets_list);
   list_init(pending_packets_list);
+
+#if WITH_PHASE_OPTIMIZATION
+  phase_init(&lpp_phase_list);
+#endif /* WITH_PHASE_OPTIMIZATION */
 }
 /*---------------------------------------------------------------------------*/
 const struct rdc_driver lpp_driver = {
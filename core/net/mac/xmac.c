@@ -46,6 +46,7 @@
 #include "lib/random.h"
 #include "net/netstack.h"
 #include "net/mac/xmac.h"
+#include "net/mac/anycast.h"
 #include "net/rime.h"
 #include "net/rime/timesynch.h"
 #include "sys/compower.h"
@@ -72,6 +73,11 @@
 #ifndef WITH_STROBE_BROADCAST
 #define WITH_STROBE_BROADCAST        0
 #endif
+#ifdef XMAC_CONF_WITH_ANYCAST
+#define WITH_ANYCAST                 XMAC_CONF_WITH_ANYCAST
+#else
+#define WITH_ANYCAST                 0
+#endif
 
 struct announcement_data {
   uint16_t id;
@@ -97,6 +103,7 @@ struct announcement_msg {
 /* #define TYPE_DATA         0x11 */
 #define TYPE_ANNOUNCEMENT 0x12
 #define TYPE_STROBE_ACK   0x13
+#define TYPE_ANYCAST_STROBE 0x14
 
 struct xmac_hdr {
   uint8_t dispatch;
@@ -447,6 +454,40 @@ detect_ack(void)
   }
   return ack_received;
 }
+#if WITH_ANYCAST
+/*---------------------------------------------------------------------------*/
+/**
+ * Anycast strobes are broadcast, so they are not acknowledged by the
+ * radio hardware. Instead, we wait for a strobe ACK packet from the
+ * neighbor that takes over the packet.
+ */
+static int
+detect_anycast_ack(rimeaddr_t *acker)
+{
+  struct xmac_hdr *hdr;
+  rtimer_clock_t wt;
+  int len;
+
+  wt = RTIMER_NOW();
+  while(RTIMER_CLOCK_LT(RTIMER_NOW(), wt + xmac_config.strobe_wait_time)) {
+    packetbuf_clear();
+    len = NETSTACK_RADIO.read(packetbuf_dataptr(), PACKETBUF_SIZE);
+    if(len > 0) {
+      packetbuf_set_datalen(len);
+      if(NETSTACK_FRAMER.parse()) {
+        hdr = packetbuf_dataptr();
+        if(hdr->dispatch == DISPATCH && hdr->type == TYPE_STROBE_ACK &&
+           rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
+                        &rimeaddr_node_addr)) {
+          rimeaddr_copy(acker, packetbuf_addr(PACKETBUF_ADDR_SENDER));
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+#endif /* WITH_ANYCAST */
 /*---------------------------------------------------------------------------*/
 static int
 send_packet(void)
@@ -468,6 +509,10 @@ send_packet(void)
   struct queuebuf *packet;
   int is_already_streaming = 0;
   uint8_t collisions;
+#if WITH_ANYCAST
+  uint16_t threshold = ANYCAST_METRIC_NONE;
+  rimeaddr_t acker;
+#endif /* WITH_ANYCAST */
 
   /* Create the X-MAC header for the data packet. */
   packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &rimeaddr_node_addr);
@@ -579,6 +624,25 @@ send_packet(void)
   }
 #endif /* WITH_ENCOUNTER_OPTIMIZATION */
 
+#if WITH_ANYCAST
+  /* Upward packets to our routing parent are strobed as anycast
+     packets, which the first awake neighbor closer to the sink may
+     take over. */
+  if(!is_broadcast && !is_already_streaming) {
+    threshold = anycast_threshold(packetbuf_attr(PACKETBUF_ATTR_CHANNEL),
+                                  packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
+    if(threshold != ANYCAST_METRIC_NONE) {
+      strobe_len = anycast_create_strobe(strobe, sizeof(strobe), DISPATCH,
+                                         TYPE_ANYCAST_STROBE, threshold);
+      if(strobe_len == 0) {
+        PRINTF("xmac: failed to create anycast strobe\n");
+        queuebuf_free(packet);
+        return MAC_TX_ERR_FATAL;
+      }
+    }
+  }
+#endif /* WITH_ANYCAST */
+
   /* By setting we_are_sending to one, we ensure that the rtimer
      powercycle interrupt do not interfere with us sending the packet. */
   we_are_sending = 1;
@@ -663,9 +727,15 @@ send_packet(void)
 	  while(RTIMER_CLOCK_LT(RTIMER_NOW(), wt + WAIT_TIME_BEFORE_STROBE_ACK));
 #endif /* 0 */
 
+#if WITH_ANYCAST
+          if(threshold != ANYCAST_METRIC_NONE) {
+            got_strobe_ack = detect_anycast_ack(&acker);
+          } else
+#endif /* WITH_ANYCAST */
           if(detect_ack()) {
             got_strobe_ack = 1;
-          } else {
+          }
+          if(!got_strobe_ack) {
             off();
           }
         }
@@ -692,6 +762,27 @@ send_packet(void)
   queuebuf_to_packetbuf(packet);
   queuebuf_free(packet);
 
+#if WITH_ANYCAST
+  if(threshold != ANYCAST_METRIC_NONE && got_strobe_ack) {
+    if(rimeaddr_cmp(&acker, packetbuf_addr(PACKETBUF_ADDR_RECEIVER))) {
+      anycast_set_forwarder(packetbuf_attr(PACKETBUF_ATTR_CHANNEL),
+                            &rimeaddr_null);
+    } else {
+      /* Another neighbor took over the packet, so we address the data
+         packet to that neighbor instead of to our parent. */
+      packetbuf_hdrreduce(len);
+      packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &acker);
+      if(NETSTACK_FRAMER.create() == 0) {
+        got_strobe_ack = 0;
+      } else {
+        packetbuf_compact();
+        anycast_set_forwarder(packetbuf_attr(PACKETBUF_ATTR_CHANNEL),
+                              &acker);
+      }
+    }
+  }
+#endif /* WITH_ANYCAST */
+
   /* Send the data packet. */
   if((is_broadcast || got_strobe_ack || is_streaming) && collisions == 0) {
     NETSTACK_RADIO.send(packetbuf_hdrptr(), packetbuf_totlen());
@@ -873,6 +964,21 @@ input_packet(void)
       /* We are done processing the strobe and we therefore return
 	 to the caller. */
       return;
+#if WITH_ANYCAST
+    } else if(hdr->type == TYPE_ANYCAST_STROBE) {
+      someone_is_sending = 2;
+
+      if(anycast_input_strobe(TYPE_STROBE_ACK)) {
+        /* We turn on the radio in anticipation of the incoming
+           packet. */
+        someone_is_sending = 1;
+        waiting_for_packet = 1;
+        on();
+        NETSTACK_RADIO.send(packetbuf_hdrptr(), packetbuf_totlen());
+        PRINTDEBUG("xmac: send anycast strobe ack %u\n", packetbuf_totlen());
+      }
+      return;
+#endif /* WITH_ANYCAST */
 #if XMAC_CONF_ANNOUNCEMENTS
     } else if(hdr->type == TYPE_ANNOUNCEMENT) {
       packetbuf_hdrreduce(sizeof(struct xmac_hdr));
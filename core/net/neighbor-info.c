@@ -40,6 +40,17 @@
 #include "net/neighbor-info.h"
 #include "net/neighbor-attr.h"
 
+#ifdef NEIGHBOR_INFO_CONF_CHECKPOINT
+#define NEIGHBOR_INFO_CHECKPOINT NEIGHBOR_INFO_CONF_CHECKPOINT
+#else /* NEIGHBOR_INFO_CONF_CHECKPOINT */
+#define NEIGHBOR_INFO_CHECKPOINT 0
+#endif /* NEIGHBOR_INFO_CONF_CHECKPOINT */
+
+#if NEIGHBOR_INFO_CHECKPOINT
+#include "lib/state-checkpoint.h"
+#include <string.h>
+#endif /* NEIGHBOR_INFO_CHECKPOINT */
+
 #define DEBUG DEBUG_NONE
 #include "net/uip-debug.h"
 
@@ -51,6 +62,15 @@
 NEIGHBOR_ATTRIBUTE(link_metric_t, etx, NULL);
 
 static neighbor_info_subscriber_t subscriber_callback;
+
+#if NEIGHBOR_INFO_CHECKPOINT
+struct checkpoint_record {
+  rimeaddr_t addr;
+  link_metric_t etx;
+};
+
+static struct state_checkpoint checkpoint;
+#endif /* NEIGHBOR_INFO_CHECKPOINT */
 /*---------------------------------------------------------------------------*/
 static void
 update_metric(const rimeaddr_t *dest, int packet_metric)
@@ -150,12 +170,54 @@ neighbor_info_packet_received(void)
   add_neighbor(src);
 }
 /*---------------------------------------------------------------------------*/
+#if NEIGHBOR_INFO_CHECKPOINT
+static int
+checkpoint_save(struct state_checkpoint *c, int index, void *record)
+{
+  struct checkpoint_record *r = record;
+  struct neighbor_addr *n;
+  link_metric_t *metricp;
+
+  for(n = neighbor_attr_list_neighbors(); n != NULL; n = n->next) {
+    metricp = (link_metric_t *)neighbor_attr_get_data(&etx, &n->addr);
+    if(metricp == NULL || *metricp == 0) {
+      /* No ETX sample for this neighbor yet. */
+      continue;
+    }
+    if(index-- == 0) {
+      memset(r, 0, sizeof(*r));
+      rimeaddr_copy(&r->addr, &n->addr);
+      r->etx = *metricp;
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+checkpoint_restore(struct state_checkpoint *c, const void *record)
+{
+  struct checkpoint_record r;
+
+  memcpy(&r, record, sizeof(r));
+  if(neighbor_attr_add_neighbor(&r.addr) >= 0) {
+    neighbor_attr_set_data(&etx, &r.addr, &r.etx);
+  }
+}
+#endif /* NEIGHBOR_INFO_CHECKPOINT */
+/*---------------------------------------------------------------------------*/
 int
 neighbor_info_subscribe(neighbor_info_subscriber_t s)
 {
   if(subscriber_callback == NULL) {
     neighbor_attr_register(&etx);
     subscriber_callback = s;
+#if NEIGHBOR_INFO_CHECKPOINT
+    state_checkpoint_register(&checkpoint, "nbretx",
+                              sizeof(struct checkpoint_record),
+                              NEIGHBOR_ATTR_MAX_NEIGHBORS,
+                              checkpoint_save, checkpoint_restore);
+#endif /* NEIGHBOR_INFO_CHECKPOINT */
     return 1;
   }
 
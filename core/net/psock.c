@@ -239,6 +239,18 @@ psock_datalen(struct psock *psock)
   return psock->bufsize - psock->buf.left;
 }
 /*---------------------------------------------------------------------------*/
+u16_t
+psock_sentlen(struct psock *s)
+{
+  /* Earlier data is still waiting for its acknowledgement, unless
+     uIP has just cleared its length, so data sent with nothing
+     outstanding was sent in this call. */
+  if(s->state != STATE_DATA_SENT || uip_rexmit() || uip_conn->len != 0) {
+    return 0;
+  }
+  return s->sendlen > uip_mss() ? uip_mss() : s->sendlen;
+}
+/*---------------------------------------------------------------------------*/
 char
 psock_newdata(struct psock *s)
 {
@@ -306,6 +306,22 @@ PT_THREAD(psock_readto(struct psock *psock, unsigned char c));
 
 u16_t psock_datalen(struct psock *psock);
 
+/**
+ * The length of the data that was sent in this call.
+ *
+ * This macro returns the length of new data that the protosocket has
+ * passed to uIP for sending during the current call of the
+ * application, or zero if it has sent none. Retransmissions do not
+ * count as new data. The data is found in the uip_appdata buffer.
+ *
+ * \param psock (struct psock *) A pointer to the protosocket.
+ *
+ * \hideinitializer
+ */
+#define PSOCK_SENTLEN(psock) psock_sentlen(psock)
+
+u16_t psock_sentlen(struct psock *psock);
+
 /**
  * Exit the protosocket's protothread.
  *
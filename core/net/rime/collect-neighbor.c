@@ -44,7 +44,9 @@
  */
 
 #include <limits.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "contiki.h"
 #include "lib/memb.h"
@@ -377,4 +379,77 @@ collect_neighbor_is_congested(struct collect_neighbor *n)
   }
 }
 /*---------------------------------------------------------------------------*/
+#if COLLECT_NEIGHBOR_CHECKPOINT
+struct checkpoint_record {
+  rimeaddr_t addr;
+  uint16_t rtmetric;
+  uint16_t etx;
+  uint8_t num_estimates;
+};
+/*---------------------------------------------------------------------------*/
+static struct collect_neighbor_list *
+checkpoint_list(struct state_checkpoint *c)
+{
+  return (struct collect_neighbor_list *)
+    ((char *)c - offsetof(struct collect_neighbor_list, checkpoint));
+}
+/*---------------------------------------------------------------------------*/
+static int
+checkpoint_save(struct state_checkpoint *c, int index, void *record)
+{
+  struct checkpoint_record *r = record;
+  struct collect_neighbor *n;
+
+  n = collect_neighbor_list_get(checkpoint_list(c), index);
+  if(n == NULL) {
+    return 0;
+  }
+  memset(r, 0, sizeof(*r));
+  rimeaddr_copy(&r->addr, &n->addr);
+  r->rtmetric = n->rtmetric;
+  r->etx = collect_link_estimate(&n->le);
+  r->num_estimates = collect_link_estimate_num_estimates(&n->le);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+checkpoint_restore(struct state_checkpoint *c, const void *record)
+{
+  struct collect_neighbor_list *neighbor_list = checkpoint_list(c);
+  struct checkpoint_record r;
+  struct collect_neighbor *n;
+
+  memcpy(&r, record, sizeof(r));
+  if(r.rtmetric >= RTMETRIC_MAX ||
+     !collect_neighbor_list_add(neighbor_list, &r.addr, r.rtmetric)) {
+    return;
+  }
+  n = collect_neighbor_list_find(neighbor_list, &r.addr);
+  if(n != NULL && r.num_estimates > 0) {
+    /* Restore the link estimate as a single sample so that the first
+       transmissions after the reboot quickly correct it if the link
+       has changed. */
+    n->le.etx_accumulator = r.etx;
+    n->le.num_estimates = 1;
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+collect_neighbor_list_checkpoint(struct collect_neighbor_list *neighbor_list,
+                                 const char *name)
+{
+  collect_neighbor_init();
+  state_checkpoint_register(&neighbor_list->checkpoint, name,
+                            sizeof(struct checkpoint_record),
+                            MAX_COLLECT_NEIGHBORS,
+                            checkpoint_save, checkpoint_restore);
+}
+/*---------------------------------------------------------------------------*/
+void
+collect_neighbor_list_checkpoint_close(struct collect_neighbor_list *neighbor_list)
+{
+  state_checkpoint_unregister(&neighbor_list->checkpoint);
+}
+/*---------------------------------------------------------------------------*/
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
 /** @} */
@@ -56,9 +56,22 @@
 #include "net/rime/collect-link-estimate.h"
 #include "lib/list.h"
 
+#ifdef COLLECT_NEIGHBOR_CONF_CHECKPOINT
+#define COLLECT_NEIGHBOR_CHECKPOINT COLLECT_NEIGHBOR_CONF_CHECKPOINT
+#else /* COLLECT_NEIGHBOR_CONF_CHECKPOINT */
+#define COLLECT_NEIGHBOR_CHECKPOINT 0
+#endif /* COLLECT_NEIGHBOR_CONF_CHECKPOINT */
+
+#if COLLECT_NEIGHBOR_CHECKPOINT
+#include "lib/state-checkpoint.h"
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
+
 struct collect_neighbor_list {
   LIST_STRUCT(list);
   struct ctimer periodic;
+#if COLLECT_NEIGHBOR_CHECKPOINT
+  struct state_checkpoint checkpoint;
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
 };
 
 struct collect_neighbor {
@@ -88,6 +101,21 @@ int collect_neighbor_list_num(struct collect_neighbor_list *neighbor_list);
 struct collect_neighbor *collect_neighbor_list_get(struct collect_neighbor_list *neighbor_list, int num);
 void collect_neighbor_list_purge(struct collect_neighbor_list *neighbor_list);
 
+#if COLLECT_NEIGHBOR_CHECKPOINT
+/**
+ * \brief      Keep a persistent snapshot of a neighbor list
+ * \param neighbor_list The neighbor list
+ * \param name A unique name for the snapshot file
+ *
+ *             Restores the neighbors, their rtmetrics and their link
+ *             estimates from the snapshot written before the last
+ *             reboot, and keeps the snapshot up to date from then on.
+ */
+void collect_neighbor_list_checkpoint(struct collect_neighbor_list *neighbor_list,
+                                      const char *name);
+void collect_neighbor_list_checkpoint_close(struct collect_neighbor_list *neighbor_list);
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
+
 void collect_neighbor_update_rtmetric(struct collect_neighbor *n,
                                       uint16_t rtmetric);
 void collect_neighbor_tx(struct collect_neighbor *n, uint16_t num_tx);
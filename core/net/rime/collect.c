@@ -51,6 +51,7 @@
 #include "net/rime/collect-link-estimate.h"
 
 #include "net/packetqueue.h"
+#include "net/mac/anycast.h"
 
 #include "dev/radio-sensor.h"
 
@@ -378,6 +379,21 @@ update_parent(struct collect_conn *tc)
   }
 }
 /*---------------------------------------------------------------------------*/
+/**
+ * Tell the RDC layer about our parent and rtmetric, so that packets
+ * to the parent can be taken over by any router that is closer to
+ * the sink and happens to be awake.
+ */
+static void
+update_anycast(struct collect_conn *tc)
+{
+  if(tc->is_router && tc->rtmetric != RTMETRIC_MAX) {
+    anycast_set_parent(&tc->anycast, &tc->parent, tc->rtmetric);
+  } else {
+    anycast_set_parent(&tc->anycast, &rimeaddr_null, ANYCAST_METRIC_NONE);
+  }
+}
+/*---------------------------------------------------------------------------*/
 /**
  * This function is called whenever there is a chance that the routing
  * metric has changed. The function goes through the list of neighbors
@@ -442,6 +458,7 @@ update_rtmetric(struct collect_conn *tc)
       }
     }
   }
+  update_anycast(tc);
 }
 /*---------------------------------------------------------------------------*/
 static int
@@ -768,8 +785,12 @@ handle_ack(struct collect_conn *tc)
          packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1],
          tc->current_parent.u8[0], tc->current_parent.u8[1],
          packetbuf_attr(PACKETBUF_ATTR_PACKET_ID), tc->seqno);
-  if(rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_SENDER),
-                  &tc->current_parent) &&
+  /* The ACK comes from our parent, or from a neighbor that took over
+     the packet at the RDC layer. */
+  if((rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_SENDER),
+                   &tc->current_parent) ||
+      rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_SENDER),
+                   anycast_forwarder(&tc->anycast))) &&
      packetbuf_attr(PACKETBUF_ATTR_PACKET_ID) == tc->seqno) {
 
     /*    printf("rtt %d / %d = %d.%02d\n",
@@ -1277,6 +1298,7 @@ collect_open(struct collect_conn *tc, uint16_t channels,
 {
   unicast_open(&tc->unicast_conn, channels + 1, &unicast_callbacks);
   channel_set_attributes(channels + 1, attributes);
+  anycast_register(&tc->anycast, channels + 1);
   tc->rtmetric = RTMETRIC_MAX;
   tc->cb = cb;
   tc->is_router = is_router;
@@ -1287,6 +1309,13 @@ collect_open(struct collect_conn *tc, uint16_t channels,
   tc->send_queue.list = &(tc->send_queue_list);
   tc->send_queue.memb = &send_queue_memb;
   collect_neighbor_init();
+#if COLLECT_NEIGHBOR_CHECKPOINT
+  {
+    char name[STATE_CHECKPOINT_NAME_LEN];
+    sprintf(name, "cn%u", channels);
+    collect_neighbor_list_checkpoint(&tc->neighbor_list, name);
+  }
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
 
 #if !COLLECT_ANNOUNCEMENTS
   neighbor_discovery_open(&tc->neighbor_discovery_conn, channels,
@@ -1307,6 +1336,12 @@ collect_open(struct collect_conn *tc, uint16_t channels,
 #endif /* COLLECT_CONF_WITH_LISTEN */
 #endif /* !COLLECT_ANNOUNCEMENTS */
 
+#if COLLECT_NEIGHBOR_CHECKPOINT
+  /* Pick a parent among the restored neighbors right away instead of
+     waiting for their next announcements. */
+  update_rtmetric(tc);
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
+
   ctimer_set(&tc->proactive_probing_timer, PROACTIVE_PROBING_INTERVAL,
              proactive_probing_callback, tc);
 
@@ -1357,6 +1392,10 @@ collect_close(struct collect_conn *tc)
   neighbor_discovery_close(&tc->neighbor_discovery_conn);
 #endif /* COLLECT_ANNOUNCEMENTS */
   unicast_close(&tc->unicast_conn);
+  anycast_remove(&tc->anycast);
+#if COLLECT_NEIGHBOR_CHECKPOINT
+  collect_neighbor_list_checkpoint_close(&tc->neighbor_list);
+#endif /* COLLECT_NEIGHBOR_CHECKPOINT */
   while(packetqueue_first(&tc->send_queue) != NULL) {
     packetqueue_dequeue(&tc->send_queue);
   }
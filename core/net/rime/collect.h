@@ -64,6 +64,7 @@
 #include "net/rime/runicast.h"
 #include "net/rime/neighbor-discovery.h"
 #include "net/rime/collect-neighbor.h"
+#include "net/mac/anycast.h"
 #include "net/packetqueue.h"
 #include "sys/ctimer.h"
 #include "lib/list.h"
@@ -112,6 +113,8 @@ struct collect_conn {
 
   struct ctimer proactive_probing_timer;
 
+  struct anycast_parent anycast;
+
   rimeaddr_t parent, current_parent;
   uint16_t rtmetric;
   uint8_t seqno;
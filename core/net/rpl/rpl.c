@@ -104,7 +104,10 @@ rpl_add_route(rpl_dag_t *dag, uip_ipaddr_t *prefix, int prefix_len,
     PRINTF(" to ");
     PRINT6ADDR(next_hop);
     PRINTF("\n");
-    uip_ipaddr_copy(&rep->nexthop, next_hop);
+    if(!uip_ipaddr_cmp(&rep->nexthop, next_hop)) {
+      uip_ipaddr_copy(&rep->nexthop, next_hop);
+      uip_ds6_gen++;
+    }
   }
   rep->state.dag = dag;
   rep->state.lifetime = DEFAULT_ROUTE_LIFETIME;
@@ -120,6 +120,18 @@ void uip_log(char *msg);
 #define SICSLOWPAN_CONF_NEIGHBOR_INFO UIP_CONF_IPV6_RPL
 #endif /* SICSLOWPAN_CONF_NEIGHBOR_INFO */
 
+#ifdef SICSLOWPAN_CONF_FRAG_FORWARDING
+#define SICSLOWPAN_FRAG_FORWARDING (SICSLOWPAN_CONF_FRAG_FORWARDING && SICSLOWPAN_CONF_FRAG)
+#else /* SICSLOWPAN_CONF_FRAG_FORWARDING */
+#define SICSLOWPAN_FRAG_FORWARDING 0
+#endif /* SICSLOWPAN_CONF_FRAG_FORWARDING */
+
+#ifdef SICSLOWPAN_CONF_FRAG_FORWARD_ENTRIES
+#define SICSLOWPAN_FRAG_FORWARD_ENTRIES SICSLOWPAN_CONF_FRAG_FORWARD_ENTRIES
+#else /* SICSLOWPAN_CONF_FRAG_FORWARD_ENTRIES */
+#define SICSLOWPAN_FRAG_FORWARD_ENTRIES 4
+#endif /* SICSLOWPAN_CONF_FRAG_FORWARD_ENTRIES */
+
 #define GET16(ptr,index) (((uint16_t)((ptr)[index] << 8)) | ((ptr)[(index) + 1]))
 #define SET16(ptr,index,value) do {     \
   (ptr)[index] = ((value) >> 8) & 0xff; \
@@ -240,6 +252,24 @@ rimeaddr_t frag_sender;
 /** Reassembly %process %timer. */
 static struct timer reass_timer;
 
+#if SICSLOWPAN_FRAG_FORWARDING
+/**
+ * A datagram that is forwarded fragment by fragment. Fragments that
+ * arrive from sender with tag are sent on to next_hop with out_tag,
+ * without reassembling the datagram.
+ */
+struct frag_forward {
+  rimeaddr_t sender;
+  rimeaddr_t next_hop;
+  uint16_t size;
+  uint16_t tag;
+  uint16_t out_tag;
+  struct timer lifetime;
+};
+
+static struct frag_forward frag_forwards[SICSLOWPAN_FRAG_FORWARD_ENTRIES];
+#endif /* SICSLOWPAN_FRAG_FORWARDING */
+
 /** @} */
 #else /* SICSLOWPAN_CONF_FRAG */
 /** The buffer used for the 6lowpan processing is uip_buf.
@@ -1457,6 +1487,221 @@ output(uip_lladdr_t *localdest)
   return 1;
 }
 
+#if SICSLOWPAN_FRAG_FORWARDING
+/*--------------------------------------------------------------------*/
+/**
+ * \brief Send a fragment, prepared in a scratch buffer, to the next hop
+ * \param frame The complete 6lowpan frame
+ * \param len The length of the frame
+ * \param next_hop The link layer address of the next hop
+ */
+static void
+send_forwarded_fragment(uint8_t *frame, uint16_t len,
+                        const rimeaddr_t *next_hop)
+{
+  rimeaddr_t dest;
+
+  /* The next hop may point into the packetbuf attributes that are
+     cleared below. */
+  rimeaddr_copy(&dest, next_hop);
+  packetbuf_clear();
+  packetbuf_copyfrom(frame, len);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS,
+                     SICSLOWPAN_MAX_MAC_TRANSMISSIONS);
+  packetbuf_set_attr(PACKETBUF_ATTR_RELIABLE, 1);
+  send_packet(&dest);
+}
+/*--------------------------------------------------------------------*/
+static struct frag_forward *
+frag_forward_lookup(const rimeaddr_t *sender, uint16_t tag, uint16_t size)
+{
+  struct frag_forward *f;
+
+  for(f = frag_forwards;
+      f < &frag_forwards[SICSLOWPAN_FRAG_FORWARD_ENTRIES]; f++) {
+    if(f->size == size && f->tag == tag &&
+       !timer_expired(&f->lifetime) &&
+       rimeaddr_cmp(&f->sender, sender)) {
+      return f;
+    }
+  }
+  return NULL;
+}
+/*--------------------------------------------------------------------*/
+/**
+ * \brief Forward a subsequent fragment of a datagram that we forward
+ * \param tag The datagram tag of the fragment
+ * \param size The datagram size of the fragment
+ * \param offset The offset of the fragment, in units of 8 bytes
+ * \return 1 if the fragment was forwarded, 0 otherwise
+ *
+ * The fragment is sent as it is, with only its datagram tag
+ * rewritten. The uip_buf is used as a scratch buffer.
+ */
+static uint8_t
+forward_fragn(uint16_t tag, uint16_t size, uint8_t offset)
+{
+  struct frag_forward *f;
+  uint8_t *frame;
+  uint16_t len;
+
+  f = frag_forward_lookup(packetbuf_addr(PACKETBUF_ADDR_SENDER), tag, size);
+  if(f == NULL) {
+    return 0;
+  }
+
+  len = packetbuf_datalen();
+  if(len < SICSLOWPAN_FRAGN_HDR_LEN) {
+    return 0;
+  }
+  frame = (uint8_t *)UIP_IP_BUF;
+  memcpy(frame, rime_ptr, len);
+  SET16(frame, RIME_FRAG_TAG, f->out_tag);
+
+  PRINTFI("sicslowpan input: forwarding fragment (tag %d -> %d, offset %d)\n",
+          tag, f->out_tag, offset);
+
+  if(((uint16_t)offset << 3) + len - SICSLOWPAN_FRAGN_HDR_LEN >= size) {
+    /* This was the last fragment of the datagram. */
+    f->size = 0;
+  }
+  send_forwarded_fragment(frame, len, &f->next_hop);
+  return 1;
+}
+/*--------------------------------------------------------------------*/
+/**
+ * \brief Forward the first fragment of a datagram that is not for us
+ * \param tag The datagram tag of the fragment
+ * \param size The datagram size of the fragment
+ * \return 1 if the fragment was forwarded, 0 if the datagram
+ * should be reassembled as usual
+ *
+ * Called after the headers of a first fragment have been
+ * uncompressed into sicslowpan_buf. If the datagram is routed
+ * through us to a neighbor that we already have a link layer
+ * address for, the hop limit is decremented, the headers are
+ * compressed for the next hop, and the fragment is sent
+ * on. Subsequent fragments are then forwarded by forward_fragn() as
+ * they arrive. Datagrams that need any other processing by the IP
+ * layer, such as ND or ICMPv6 errors, are reassembled.
+ *
+ * The fragment offsets refer to the uncompressed datagram, so they
+ * remain valid for the next hop as long as the recompressed first
+ * fragment carries exactly the same part of the datagram.
+ */
+static uint8_t
+forward_frag1(uint16_t tag, uint16_t size)
+{
+  struct frag_forward *f;
+  uip_ds6_nbr_t *nbr;
+  uip_ds6_route_t *locrt;
+  uip_ipaddr_t *nexthop;
+  rimeaddr_t sender;
+  uint8_t *rime_ptr_in;
+  uint8_t rime_hdr_len_in, uncomp_hdr_len_in;
+  uint16_t covered, payload_len;
+  uint8_t *frame;
+
+  if(uip_is_addr_mcast(&SICSLOWPAN_IP_BUF->destipaddr) ||
+     uip_ds6_is_my_addr(&SICSLOWPAN_IP_BUF->destipaddr) ||
+     uip_ds6_is_my_aaddr(&SICSLOWPAN_IP_BUF->destipaddr) ||
+     SICSLOWPAN_IP_BUF->ttl <= 1 ||
+     packetbuf_datalen() < rime_hdr_len) {
+    return 0;
+  }
+
+  /* Next hop determination, as in tcpip_ipv6_output(). */
+  if(uip_ds6_is_addr_onlink(&SICSLOWPAN_IP_BUF->destipaddr)) {
+    nexthop = &SICSLOWPAN_IP_BUF->destipaddr;
+  } else {
+    locrt = uip_ds6_route_lookup(&SICSLOWPAN_IP_BUF->destipaddr);
+    if(locrt != NULL) {
+      nexthop = &locrt->nexthop;
+    } else if((nexthop = uip_ds6_defrt_choose()) == NULL) {
+      return 0;
+    }
+  }
+  nbr = uip_ds6_nbr_lookup(nexthop);
+  if(nbr == NULL || nbr->state == NBR_INCOMPLETE) {
+    return 0;
+  }
+
+  /* Find a free forwarding entry. */
+  for(f = frag_forwards;
+      f < &frag_forwards[SICSLOWPAN_FRAG_FORWARD_ENTRIES]; f++) {
+    if(f->size == 0 || timer_expired(&f->lifetime)) {
+      break;
+    }
+  }
+  if(f == &frag_forwards[SICSLOWPAN_FRAG_FORWARD_ENTRIES]) {
+    return 0;
+  }
+
+  /* Put the part of the datagram carried by this fragment in uip_buf,
+     with the hop limit decremented. */
+  payload_len = packetbuf_datalen() - rime_hdr_len;
+  covered = uncomp_hdr_len + payload_len;
+  memcpy(UIP_IP_BUF, SICSLOWPAN_IP_BUF, uncomp_hdr_len);
+  memcpy((uint8_t *)UIP_IP_BUF + uncomp_hdr_len,
+         rime_ptr + rime_hdr_len, payload_len);
+  UIP_IP_BUF->ttl--;
+
+  /* Compress the headers for the next hop into the space after the
+     datagram in uip_buf, leaving room for the FRAG1 header. */
+  rime_ptr_in = rime_ptr;
+  rime_hdr_len_in = rime_hdr_len;
+  uncomp_hdr_len_in = uncomp_hdr_len;
+  frame = (uint8_t *)UIP_IP_BUF + covered;
+  rime_ptr = frame + SICSLOWPAN_FRAG1_HDR_LEN;
+  rime_hdr_len = 0;
+  uncomp_hdr_len = 0;
+#if SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC1
+  compress_hdr_hc1((rimeaddr_t *)&nbr->lladdr);
+#endif /* SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC1 */
+#if SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_IPV6
+  compress_hdr_ipv6((rimeaddr_t *)&nbr->lladdr);
+#endif /* SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_IPV6 */
+#if SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC06
+  compress_hdr_hc06((rimeaddr_t *)&nbr->lladdr);
+#endif /* SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC06 */
+
+  if(uncomp_hdr_len > covered ||
+     SICSLOWPAN_FRAG1_HDR_LEN + rime_hdr_len + covered - uncomp_hdr_len >
+     MAC_MAX_PAYLOAD) {
+    /* The headers do not compress as well for the next hop, so the
+       fragment does not fit. Fall back to reassembly. */
+    PRINTFI("sicslowpan input: first fragment does not fit, reassembling\n");
+    rime_ptr = rime_ptr_in;
+    rime_hdr_len = rime_hdr_len_in;
+    uncomp_hdr_len = uncomp_hdr_len_in;
+    return 0;
+  }
+
+  payload_len = covered - uncomp_hdr_len;
+  memcpy(rime_ptr + rime_hdr_len, (uint8_t *)UIP_IP_BUF + uncomp_hdr_len,
+         payload_len);
+  SET16(frame, RIME_FRAG_DISPATCH_SIZE,
+        ((SICSLOWPAN_DISPATCH_FRAG1 << 8) | size));
+  SET16(frame, RIME_FRAG_TAG, my_tag);
+
+  rimeaddr_copy(&sender, packetbuf_addr(PACKETBUF_ADDR_SENDER));
+  rimeaddr_copy(&f->sender, &sender);
+  rimeaddr_copy(&f->next_hop, (rimeaddr_t *)&nbr->lladdr);
+  f->size = size;
+  f->tag = tag;
+  f->out_tag = my_tag;
+  timer_set(&f->lifetime, SICSLOWPAN_REASS_MAXAGE * CLOCK_SECOND);
+  my_tag++;
+
+  PRINTFI("sicslowpan input: forwarding first fragment (tag %d -> %d)\n",
+          tag, f->out_tag);
+
+  send_forwarded_fragment(frame,
+                          SICSLOWPAN_FRAG1_HDR_LEN + rime_hdr_len + payload_len,
+                          &f->next_hop);
+  return 1;
+}
+#endif /* SICSLOWPAN_FRAG_FORWARDING */
 /*--------------------------------------------------------------------*/
 /** \brief Process a received 6lowpan packet.
  *  \param r The MAC layer
@@ -1531,6 +1776,13 @@ input(void)
       break;
   }
 
+#if SICSLOWPAN_FRAG_FORWARDING
+  if(frag_size > 0 && first_fragment == 0 &&
+     forward_fragn(frag_tag, frag_size, frag_offset)) {
+    return;
+  }
+#endif /* SICSLOWPAN_FRAG_FORWARDING */
+
   if(processed_ip_len > 0) {
     /* reassembly is ongoing */
     /*    printf("frag %d %d\n", reass_tag, frag_tag);*/
@@ -1608,6 +1860,16 @@ input(void)
   }
    
     
+#if SICSLOWPAN_FRAG_FORWARDING
+  if(first_fragment != 0 && forward_frag1(frag_tag, frag_size)) {
+    /* The datagram is forwarded fragment by fragment; cancel the
+       reassembly that was started for it. */
+    sicslowpan_len = 0;
+    processed_ip_len = 0;
+    return;
+  }
+#endif /* SICSLOWPAN_FRAG_FORWARDING */
+
 #if SICSLOWPAN_CONF_FRAG
  copypayload:
 #endif /*SICSLOWPAN_CONF_FRAG*/
@@ -50,6 +50,7 @@
 #if UIP_CONF_IPV6
 #include "net/uip-nd6.h"
 #include "net/uip-ds6.h"
+#include "net/uip-mpl.h"
 #endif
 
 #define DEBUG 0
@@ -423,7 +424,7 @@ eventhandler(process_event_t ev, process_data_t data)
         for(cptr = &uip_udp_conns[0];
             cptr < &uip_udp_conns[UIP_UDP_CONNS]; ++cptr) {
           if(cptr->appstate.p == p) {
-            cptr->lport = 0;
+            uip_udp_remove(cptr);
           }
         }
       
@@ -559,11 +560,86 @@ loopback_packet(void) {
 #endif
 /*---------------------------------------------------------------------------*/
 #if UIP_CONF_IPV6
+#ifdef TCPIP_CONF_DEST_CACHE_NB
+#define DEST_CACHE_NB TCPIP_CONF_DEST_CACHE_NB
+#else /* TCPIP_CONF_DEST_CACHE_NB */
+#define DEST_CACHE_NB 8
+#endif /* TCPIP_CONF_DEST_CACHE_NB */
+
+#if DEST_CACHE_NB > 0
+/* Recent destinations and the neighbor that is their next hop, so
+   that the prefix list, routing table and neighbor cache need not be
+   searched for every packet. The cache is direct mapped on the last
+   bytes of the address, and is flushed whenever uip_ds6_gen changes. */
+static struct dest_cache {
+  uip_ipaddr_t ipaddr;
+  uip_ds6_nbr_t *nbr;
+} dest_cache[DEST_CACHE_NB];
+static uint16_t dest_cache_gen;
+
+#define DEST_CACHE_INDEX(addr) \
+  (((addr)->u8[14] ^ (addr)->u8[15]) % DEST_CACHE_NB)
+
+static uip_ds6_nbr_t *
+dest_cache_lookup(uip_ipaddr_t *ipaddr)
+{
+  struct dest_cache *d;
+
+  if(dest_cache_gen != uip_ds6_gen) {
+    for(d = dest_cache; d < &dest_cache[DEST_CACHE_NB]; ++d) {
+      d->nbr = NULL;
+    }
+    dest_cache_gen = uip_ds6_gen;
+    return NULL;
+  }
+  d = &dest_cache[DEST_CACHE_INDEX(ipaddr)];
+  if(d->nbr != NULL && uip_ipaddr_cmp(&d->ipaddr, ipaddr)) {
+    return d->nbr;
+  }
+  return NULL;
+}
+
+static void
+dest_cache_add(uip_ipaddr_t *ipaddr, uip_ds6_nbr_t *nbr)
+{
+  struct dest_cache *d;
+
+  /* A neighbor that is still being resolved is not cached, as a
+     default router that is reachable may be preferred to it later. */
+  if(nbr->state != NBR_INCOMPLETE) {
+    d = &dest_cache[DEST_CACHE_INDEX(ipaddr)];
+    uip_ipaddr_copy(&d->ipaddr, ipaddr);
+    d->nbr = nbr;
+  }
+}
+#else /* DEST_CACHE_NB > 0 */
+#define dest_cache_lookup(ipaddr) NULL
+#define dest_cache_add(ipaddr, nbr)
+#endif /* DEST_CACHE_NB > 0 */
+
+/* Keeps the packet in uip_buf until nbr has been resolved, or counts
+   it as dropped if there is no room. */
+static void
+queue_packet(uip_ds6_nbr_t *nbr)
+{
+#if UIP_CONF_IPV6_QUEUE_PKT
+  struct uip_packetqueue_packet *p;
+
+  p = uip_packetqueue_alloc(&nbr->packethandle, UIP_DS6_NBR_PACKET_LIFETIME);
+  if(p != NULL) {
+    memcpy(p->queue_buf, UIP_IP_BUF, uip_len);
+    p->queue_buf_len = uip_len;
+    return;
+  }
+#endif /* UIP_CONF_IPV6_QUEUE_PKT */
+  UIP_STAT(++uip_stat.nd6.qdrop);
+}
+
 void
 tcpip_ipv6_output(void)
 {
   uip_ds6_nbr_t *nbr = NULL;
-  uip_ipaddr_t* nexthop;
+  uip_ipaddr_t* nexthop = NULL;
   
   if(uip_len == 0) {
     return;
@@ -587,41 +663,41 @@ tcpip_ipv6_output(void)
 #endif
   if(!uip_is_addr_mcast(&UIP_IP_BUF->destipaddr)) {
     /* Next hop determination */
-    nbr = NULL;
-    if(uip_ds6_is_addr_onlink(&UIP_IP_BUF->destipaddr)){
-      nexthop = &UIP_IP_BUF->destipaddr;
-    } else {
-      uip_ds6_route_t* locrt;
-      locrt = uip_ds6_route_lookup(&UIP_IP_BUF->destipaddr);
-      if(locrt == NULL) {
-        if((nexthop = uip_ds6_defrt_choose()) == NULL) {
+    nbr = dest_cache_lookup(&UIP_IP_BUF->destipaddr);
+    if(nbr == NULL) {
+      if(uip_ds6_is_addr_onlink(&UIP_IP_BUF->destipaddr)){
+        nexthop = &UIP_IP_BUF->destipaddr;
+      } else {
+        uip_ds6_route_t* locrt;
+        locrt = uip_ds6_route_lookup(&UIP_IP_BUF->destipaddr);
+        if(locrt == NULL) {
+          if((nexthop = uip_ds6_defrt_choose()) == NULL) {
 #ifdef UIP_FALLBACK_INTERFACE
-	  UIP_FALLBACK_INTERFACE.output();
+	    UIP_FALLBACK_INTERFACE.output();
 #else
-          PRINTF("tcpip_ipv6_output: Destination off-link but no route\n");
+            PRINTF("tcpip_ipv6_output: Destination off-link but no route\n");
 #endif
-          uip_len = 0;
-          return;
+            uip_len = 0;
+            return;
+          }
+        } else {
+	  nexthop = &locrt->nexthop;
         }
-      } else {
-	nexthop = &locrt->nexthop;
+      }
+      if((nbr = uip_ds6_nbr_lookup(nexthop)) != NULL) {
+        dest_cache_add(&UIP_IP_BUF->destipaddr, nbr);
       }
     }
     /* end of next hop determination */
-    if((nbr = uip_ds6_nbr_lookup(nexthop)) == NULL) {
+    if(nbr == NULL) {
       //      printf("add1 %d\n", nexthop->u8[15]);
       if((nbr = uip_ds6_nbr_add(nexthop, NULL, 0, NBR_INCOMPLETE)) == NULL) {
         //        printf("add n\n");
         uip_len = 0;
         return;
       } else {
-#if UIP_CONF_IPV6_QUEUE_PKT
         /* copy outgoing pkt in the queuing buffer for later transmmit */
-        if(uip_packetqueue_alloc(&nbr->packethandle, UIP_DS6_NBR_PACKET_LIFETIME) != NULL) {
-          memcpy(uip_packetqueue_buf(&nbr->packethandle), UIP_IP_BUF, uip_len);
-          uip_packetqueue_set_buflen(&nbr->packethandle, uip_len);
-        }
-#endif
+        queue_packet(nbr);
       /* RFC4861, 7.2.2:
        * "If the source address of the packet prompting the solicitation is the
        * same as one of the addresses assigned to the outgoing interface, that
@@ -640,17 +716,10 @@ tcpip_ipv6_output(void)
     } else {
       if(nbr->state == NBR_INCOMPLETE) {
         PRINTF("tcpip_ipv6_output: nbr cache entry incomplete\n");
-#if UIP_CONF_IPV6_QUEUE_PKT
         /* copy outgoing pkt in the queuing buffer for later transmmit and set
            the destination nbr to nbr */
-        if(uip_packetqueue_alloc(&nbr->packethandle, UIP_DS6_NBR_PACKET_LIFETIME) != NULL) {
-          memcpy(uip_packetqueue_buf(&nbr->packethandle), UIP_IP_BUF, uip_len);
-          uip_packetqueue_set_buflen(&nbr->packethandle, uip_len);
-        }
-        /*        memcpy(nbr->queue_buf, UIP_IP_BUF, uip_len);
-                  nbr->queue_buf_len = uip_len;*/
+        queue_packet(nbr);
         uip_len = 0;
-#endif /*UIP_CONF_IPV6_QUEUE_PKT*/
         return;
       }
       /* if running NUD (nbc->state == STALE, DELAY, or PROBE ) keep
@@ -667,27 +736,15 @@ tcpip_ipv6_output(void)
       stimer_set(&(nbr->sendns),
                 uip_ds6_if.retrans_timer / 1000);
 
-      tcpip_output(&(nbr->lladdr));
-
-
 #if UIP_CONF_IPV6_QUEUE_PKT
-      /* Send the queued packets from here, may not be 100% perfect though.
-       * This happens in a few cases, for example when instead of receiving a
-       * NA after sendiong a NS, you receive a NS with SLLAO: the entry moves
-       *to STALE, and you must both send a NA and the queued packet
+      /* Packets may still be queued, for example when instead of
+       * receiving a NA after sending a NS, you receive a NS with SLLAO:
+       * the entry moves to STALE, and you must both send a NA and the
+       * queued packets. They go out before the current packet.
        */
-      /*      if(nbr->queue_buf_len != 0) {
-        uip_len = nbr->queue_buf_len;
-        memcpy(UIP_IP_BUF, nbr->queue_buf, uip_len);
-        nbr->queue_buf_len = 0;
-        tcpip_output(&(nbr->lladdr));
-        }*/
-      if(uip_packetqueue_buflen(&nbr->packethandle) != 0) {
-        uip_len = uip_packetqueue_buflen(&nbr->packethandle);
-        memcpy(UIP_IP_BUF, uip_packetqueue_buf(&nbr->packethandle), uip_len);
-        uip_packetqueue_free(&nbr->packethandle);
-        tcpip_output(&(nbr->lladdr));
-      }
+      uip_packetqueue_send(&nbr->packethandle, &nbr->lladdr);
+#else /*UIP_CONF_IPV6_QUEUE_PKT*/
+      tcpip_output(&(nbr->lladdr));
 #endif /*UIP_CONF_IPV6_QUEUE_PKT*/
 
       uip_len = 0;
@@ -696,6 +753,12 @@ tcpip_ipv6_output(void)
   }
    
   /*multicast IP destination address */
+#if UIP_CONF_IPV6_MULTICAST
+  if(uip_mpl_is_addr_realm(&UIP_IP_BUF->destipaddr) && !uip_mpl_out()) {
+    uip_len = 0;
+    return;
+  }
+#endif /* UIP_CONF_IPV6_MULTICAST */
   tcpip_output(NULL);
   uip_len = 0;
   uip_ext_len = 0;
@@ -77,6 +77,7 @@ uip_ds6_nbr_t uip_ds6_nbr_cache[UIP_DS6_NBR_NB];                  /** \brief Nei
 uip_ds6_defrt_t uip_ds6_defrt_list[UIP_DS6_DEFRT_NB];             /** \brief Default rt list */
 uip_ds6_prefix_t uip_ds6_prefix_list[UIP_DS6_PREFIX_NB];          /** \brief Prefix list */
 uip_ds6_route_t uip_ds6_routing_table[UIP_DS6_ROUTE_NB];          /** \brief Routing table */
+uint16_t uip_ds6_gen;                                             /** \brief Bumped when a neighbor, default router, prefix or route is added or removed */
 
 /** @} */
 
@@ -248,7 +249,7 @@ uip_ds6_periodic(void)
 
 /*---------------------------------------------------------------------------*/
 uint8_t
-uip_ds6_list_loop(uip_ds6_element_t *list, uint8_t size,
+uip_ds6_list_loop(uip_ds6_element_t *list, uint16_t size,
                   uint16_t elementsize, uip_ipaddr_t *ipaddr,
                   uint8_t ipaddrlen, uip_ds6_element_t **out_element)
 {
@@ -308,6 +309,7 @@ uip_ds6_nbr_add(uip_ipaddr_t *ipaddr, uip_lladdr_t * lladdr,
     PRINTLLADDR((&(locnbr->lladdr)));
     PRINTF("state %u\n", state);
     NEIGHBOR_STATE_CHANGED(locnbr);
+    uip_ds6_gen++;
 
     locnbr->last_lookup = clock_time();
     return locnbr;
@@ -346,9 +348,12 @@ uip_ds6_nbr_rm(uip_ds6_nbr_t *nbr)
   if(nbr != NULL) {
     nbr->isused = 0;
 #if UIP_CONF_IPV6_QUEUE_PKT
+    UIP_STAT(uip_stat.nd6.unresolved +=
+             uip_packetqueue_len(&nbr->packethandle));
     uip_packetqueue_free(&nbr->packethandle);
 #endif /* UIP_CONF_IPV6_QUEUE_PKT */
     NEIGHBOR_STATE_CHANGED(nbr);
+    uip_ds6_gen++;
   }
   return;
 }
@@ -382,6 +387,7 @@ uip_ds6_defrt_add(uip_ipaddr_t *ipaddr, unsigned long interval)
     } else {
       locdefrt->isinfinite = 1;
     }
+    uip_ds6_gen++;
 
     PRINTF("Adding defrouter with ip addr ");
     PRINT6ADDR(&locdefrt->ipaddr);
@@ -400,6 +406,7 @@ uip_ds6_defrt_rm(uip_ds6_defrt_t *defrt)
 {
   if(defrt != NULL) {
     defrt->isused = 0;
+    uip_ds6_gen++;
     ANNOTATE("#L %u 0\n", defrt->ipaddr.u8[sizeof(uip_ipaddr_t) - 1]);
   }
   return;
@@ -465,6 +472,7 @@ uip_ds6_prefix_add(uip_ipaddr_t *ipaddr, uint8_t ipaddrlen,
     locprefix->l_a_reserved = flags;
     locprefix->vlifetime = vtime;
     locprefix->plifetime = ptime;
+    uip_ds6_gen++;
     PRINTF("Adding prefix ");
     PRINT6ADDR(&locprefix->ipaddr);
     PRINTF("length %u, flags %x, Valid lifetime %lx, Preffered lifetime %lx\n",
@@ -495,6 +503,7 @@ uip_ds6_prefix_add(uip_ipaddr_t *ipaddr, uint8_t ipaddrlen,
     } else {
       locprefix->isinfinite = 1;
     }
+    uip_ds6_gen++;
     PRINTF("Adding prefix ");
     PRINT6ADDR(&locprefix->ipaddr);
     PRINTF("length %u, vlifetime%lu\n", ipaddrlen, interval);
@@ -509,6 +518,7 @@ uip_ds6_prefix_rm(uip_ds6_prefix_t * prefix)
 {
   if(prefix != NULL) {
     prefix->isused = 0;
+    uip_ds6_gen++;
   }
   return;
 }
@@ -758,6 +768,7 @@ uip_ds6_route_add(uip_ipaddr_t *ipaddr, uint8_t length, uip_ipaddr_t *nexthop,
     locroute->length = length;
     uip_ipaddr_copy(&(locroute->nexthop), nexthop);
     locroute->metric = metric;
+    uip_ds6_gen++;
 
     PRINTF("DS6: adding route: ");
     PRINT6ADDR(ipaddr);
@@ -775,6 +786,7 @@ void
 uip_ds6_route_rm(uip_ds6_route_t *route)
 {
   route->isused = 0;
+  uip_ds6_gen++;
 #if (DEBUG & DEBUG_ANNOTATE) == DEBUG_ANNOTATE
   /* we need to check if this was the last route towards "nexthop" */
   /* if so - remove that link (annotation) */
@@ -800,6 +812,7 @@ uip_ds6_route_rm_by_nexthop(uip_ipaddr_t *nexthop)
       locroute->isused = 0;
     }
   }
+  uip_ds6_gen++;
   ANNOTATE("#L %u 0\n",nexthop->u8[sizeof(uip_ipaddr_t) - 1]);
 }
 
@@ -282,6 +282,7 @@ typedef struct uip_ds6_element {
 /*---------------------------------------------------------------------------*/
 extern uip_ds6_netif_t uip_ds6_if;
 extern struct etimer uip_ds6_timer_periodic;
+extern uint16_t uip_ds6_gen;
 
 #if UIP_CONF_ROUTER
 extern uip_ds6_prefix_t uip_ds6_prefix_list[UIP_DS6_PREFIX_NB];
@@ -299,7 +300,7 @@ void uip_ds6_periodic(void);
 
 /** \brief Generic loop routine on an abstract data structure, which generalizes
  * all data structures used in DS6 */
-uint8_t uip_ds6_list_loop(uip_ds6_element_t *list, uint8_t size,
+uint8_t uip_ds6_list_loop(uip_ds6_element_t *list, uint16_t size,
                           uint16_t elementsize, uip_ipaddr_t *ipaddr,
                           uint8_t ipaddrlen,
                           uip_ds6_element_t **out_element);
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         Realm-local multicast forwarding with MPL
+ */
+
+#include <string.h>
+
+#include "net/uip.h"
+#include "net/tcpip.h"
+#include "net/uip-ds6.h"
+#include "net/uip-mpl.h"
+#include "lib/random.h"
+#include "sys/ctimer.h"
+#include "sys/stimer.h"
+
+#if UIP_CONF_IPV6_MULTICAST
+
+#define DEBUG 0
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+#define UIP_IP_BUF  ((struct uip_ip_hdr *)&uip_buf[UIP_LLH_LEN])
+#define UIP_HBH_BUF ((uint8_t *)&uip_buf[UIP_LLH_LEN + UIP_IPH_LEN])
+
+/* Hop-by-hop header with the MPL option, seed id taken from the
+   source address, and two bytes of padding. */
+#define MPL_HBH_LEN 8
+#define MPL_OPT_LEN 2
+
+#define IMAX ((clock_time_t)UIP_MPL_IMIN << UIP_MPL_IMAX_DOUBLINGS)
+
+#define SEQ_LT(a, b) ((int8_t)((uint8_t)(a) - (uint8_t)(b)) < 0)
+
+struct mpl_seed {
+  uip_ipaddr_t addr;
+  struct stimer lifetime;
+  uint8_t min_seq;
+  uint8_t used;
+};
+
+struct mpl_msg {
+  struct mpl_seed *seed;
+  struct ctimer timer;
+  clock_time_t i, t;
+  uint16_t len;
+  uint8_t seq;
+  uint8_t c;
+  uint8_t e;
+  uint8_t sent;
+  uint8_t buf[UIP_MPL_BUFSIZE];
+};
+
+static struct mpl_seed seeds[UIP_MPL_SEEDS];
+static struct mpl_msg msgs[UIP_MPL_BUFFERED_MESSAGES];
+static uint8_t seq;
+
+static void trickle_timer(void *ptr);
+/*---------------------------------------------------------------------------*/
+static struct mpl_seed *
+seed_lookup(uip_ipaddr_t *addr)
+{
+  struct mpl_seed *s;
+
+  for(s = seeds; s < &seeds[UIP_MPL_SEEDS]; s++) {
+    if(s->used && uip_ipaddr_cmp(&s->addr, addr)) {
+      return s;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static uint8_t
+seed_has_msgs(struct mpl_seed *s)
+{
+  struct mpl_msg *m;
+
+  for(m = msgs; m < &msgs[UIP_MPL_BUFFERED_MESSAGES]; m++) {
+    if(m->seed == s) {
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+/* A seed whose lifetime has run out can be reused once all its
+   messages have been dropped. */
+static struct mpl_seed *
+seed_add(uip_ipaddr_t *addr, uint8_t min_seq)
+{
+  struct mpl_seed *s;
+
+  for(s = seeds; s < &seeds[UIP_MPL_SEEDS]; s++) {
+    if(!s->used ||
+       (stimer_expired(&s->lifetime) && !seed_has_msgs(s))) {
+      uip_ipaddr_copy(&s->addr, addr);
+      s->min_seq = min_seq;
+      s->used = 1;
+      stimer_set(&s->lifetime, UIP_MPL_SEED_LIFETIME);
+      return s;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static struct mpl_msg *
+msg_lookup(struct mpl_seed *s, uint8_t seq)
+{
+  struct mpl_msg *m;
+
+  for(m = msgs; m < &msgs[UIP_MPL_BUFFERED_MESSAGES]; m++) {
+    if(m->seed == s && m->seq == seq) {
+      return m;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+/* Removes a message and everything older from the same seed, whose
+   window then starts after it. */
+static void
+msg_free(struct mpl_msg *m)
+{
+  struct mpl_seed *s = m->seed;
+
+  if(SEQ_LT(s->min_seq, m->seq + 1)) {
+    s->min_seq = m->seq + 1;
+  }
+  for(m = msgs; m < &msgs[UIP_MPL_BUFFERED_MESSAGES]; m++) {
+    if(m->seed == s && SEQ_LT(m->seq, s->min_seq)) {
+      ctimer_stop(&m->timer);
+      m->seed = NULL;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+trickle_interval(struct mpl_msg *m)
+{
+  clock_time_t half;
+
+  half = m->i / 2;
+  m->t = half + (half > 0 ? random_rand() % half : 0);
+  m->c = 0;
+  m->sent = 0;
+  ctimer_set(&m->timer, m->t, trickle_timer, m);
+}
+/*---------------------------------------------------------------------------*/
+static void
+trickle_timer(void *ptr)
+{
+  struct mpl_msg *m = ptr;
+
+  if(!m->sent) {
+    m->sent = 1;
+    /* Sent only if fewer than k copies were heard in this interval,
+       and not if the hop limit ran out on the way here. */
+    if(m->c < UIP_MPL_K && ((struct uip_ip_hdr *)m->buf)->ttl > 0) {
+      PRINTF("MPL: sending seq %u\n", m->seq);
+      memcpy(UIP_IP_BUF, m->buf, m->len);
+      uip_len = m->len;
+      tcpip_output(NULL);
+      uip_len = 0;
+      UIP_STAT(++uip_stat.mpl.fwd);
+    }
+    ctimer_set(&m->timer, m->i - m->t, trickle_timer, m);
+    return;
+  }
+
+  if(++m->e >= UIP_MPL_EXPIRATIONS) {
+    PRINTF("MPL: done with seq %u\n", m->seq);
+    msg_free(m);
+    return;
+  }
+  if(m->i < IMAX) {
+    m->i *= 2;
+  }
+  trickle_interval(m);
+}
+/*---------------------------------------------------------------------------*/
+/* Copies the packet in uip_buf for retransmission. When all buffers
+   are taken, the message that has been sent the longest is dropped. */
+static struct mpl_msg *
+msg_add(struct mpl_seed *s, uint8_t seq)
+{
+  struct mpl_msg *m, *oldest;
+
+  if(uip_len > UIP_MPL_BUFSIZE) {
+    return NULL;
+  }
+  oldest = msgs;
+  for(m = msgs; m < &msgs[UIP_MPL_BUFFERED_MESSAGES]; m++) {
+    if(m->seed == NULL) {
+      break;
+    }
+    if(m->e > oldest->e) {
+      oldest = m;
+    }
+  }
+  if(m == &msgs[UIP_MPL_BUFFERED_MESSAGES]) {
+    m = oldest;
+    msg_free(m);
+    if(SEQ_LT(seq, s->min_seq)) {
+      return NULL;
+    }
+  }
+
+  memcpy(m->buf, UIP_IP_BUF, uip_len);
+  m->len = uip_len;
+  m->seed = s;
+  m->seq = seq;
+  m->i = UIP_MPL_IMIN;
+  m->e = 0;
+  trickle_interval(m);
+  return m;
+}
+/*---------------------------------------------------------------------------*/
+/* The MPL option in the hop-by-hop header of the packet in uip_buf. */
+static uint8_t *
+mpl_option(void)
+{
+  uint8_t *hbh = UIP_HBH_BUF;
+  uint16_t off, len;
+
+  if(UIP_IP_BUF->proto != UIP_PROTO_HBHO) {
+    return NULL;
+  }
+  len = (hbh[1] << 3) + 8;
+  if(len > uip_len - UIP_IPH_LEN) {
+    return NULL;
+  }
+  off = 2;
+  while(off + 1 < len) {
+    if(hbh[off] == UIP_EXT_HDR_OPT_PAD1) {
+      off++;
+      continue;
+    }
+    if(hbh[off] == UIP_EXT_HDR_OPT_MPL) {
+      if(hbh[off + 1] >= MPL_OPT_LEN && off + 2 + MPL_OPT_LEN <= len) {
+        return &hbh[off];
+      }
+      return NULL;
+    }
+    off += hbh[off + 1] + 2;
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_mpl_init(void)
+{
+  memset(seeds, 0, sizeof(seeds));
+  memset(msgs, 0, sizeof(msgs));
+  seq = random_rand();
+}
+/*---------------------------------------------------------------------------*/
+uint8_t
+uip_mpl_out(void)
+{
+  uint8_t *hbh = UIP_HBH_BUF;
+  struct mpl_seed *s;
+
+  if(UIP_IP_BUF->proto == UIP_PROTO_HBHO) {
+    PRINTF("MPL: packet already has a hop-by-hop header\n");
+    return 1;
+  }
+  if(uip_len + MPL_HBH_LEN > UIP_LINK_MTU ||
+     uip_len + MPL_HBH_LEN > UIP_BUFSIZE - UIP_LLH_LEN) {
+    UIP_STAT(++uip_stat.mpl.drop);
+    return 0;
+  }
+
+  memmove(hbh + MPL_HBH_LEN, hbh, uip_len - UIP_IPH_LEN);
+  hbh[0] = UIP_IP_BUF->proto;
+  hbh[1] = 0;
+  hbh[2] = UIP_EXT_HDR_OPT_MPL;
+  hbh[3] = MPL_OPT_LEN;
+  hbh[4] = 0;
+  hbh[5] = seq;
+  hbh[6] = UIP_EXT_HDR_OPT_PADN;
+  hbh[7] = 0;
+  UIP_IP_BUF->proto = UIP_PROTO_HBHO;
+  uip_len += MPL_HBH_LEN;
+  UIP_IP_BUF->len[0] = (uip_len - UIP_IPH_LEN) >> 8;
+  UIP_IP_BUF->len[1] = (uip_len - UIP_IPH_LEN) & 0xff;
+
+  s = seed_lookup(&UIP_IP_BUF->srcipaddr);
+  if(s == NULL) {
+    s = seed_add(&UIP_IP_BUF->srcipaddr, seq);
+  }
+  if(s != NULL) {
+    stimer_set(&s->lifetime, UIP_MPL_SEED_LIFETIME);
+    msg_add(s, seq);
+  }
+  UIP_STAT(++uip_stat.mpl.sent);
+  seq++;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+uint8_t
+uip_mpl_in(void)
+{
+  struct mpl_seed *s;
+  struct mpl_msg *m;
+  uint8_t *opt;
+  uint8_t msg_seq;
+
+  opt = mpl_option();
+  if(opt == NULL) {
+    /* Not an MPL message, delivered but not forwarded. */
+    return UIP_MPL_ACCEPT;
+  }
+  if((opt[2] >> 6) != 0) {
+    PRINTF("MPL: seed id length not supported\n");
+    UIP_STAT(++uip_stat.mpl.drop);
+    return UIP_MPL_DROP;
+  }
+  msg_seq = opt[3];
+
+  s = seed_lookup(&UIP_IP_BUF->srcipaddr);
+  if(s != NULL) {
+    stimer_set(&s->lifetime, UIP_MPL_SEED_LIFETIME);
+    if(SEQ_LT(msg_seq, s->min_seq)) {
+      UIP_STAT(++uip_stat.mpl.dup);
+      return UIP_MPL_DROP;
+    }
+    m = msg_lookup(s, msg_seq);
+    if(m != NULL) {
+      /* A consistent transmission, counts against our own. */
+      m->c++;
+      UIP_STAT(++uip_stat.mpl.dup);
+      return UIP_MPL_DROP;
+    }
+  } else {
+    if(uip_ds6_is_my_addr(&UIP_IP_BUF->srcipaddr)) {
+      UIP_STAT(++uip_stat.mpl.dup);
+      return UIP_MPL_DROP;
+    }
+    s = seed_add(&UIP_IP_BUF->srcipaddr, msg_seq);
+    if(s == NULL) {
+      /* Without a window, duplicates could not be told apart. */
+      PRINTF("MPL: no room for seed\n");
+      UIP_STAT(++uip_stat.mpl.drop);
+      return UIP_MPL_DROP;
+    }
+  }
+
+  UIP_STAT(++uip_stat.mpl.recv);
+  m = msg_add(s, msg_seq);
+  if(m != NULL) {
+    if(((struct uip_ip_hdr *)m->buf)->ttl > 0) {
+      ((struct uip_ip_hdr *)m->buf)->ttl--;
+    }
+  } else {
+    UIP_STAT(++uip_stat.mpl.drop);
+  }
+
+  if(!uip_ds6_is_my_maddr(&UIP_IP_BUF->destipaddr)) {
+    return UIP_MPL_DROP;
+  }
+  return UIP_MPL_ACCEPT;
+}
+/*---------------------------------------------------------------------------*/
+#endif /* UIP_CONF_IPV6_MULTICAST */
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         Realm-local multicast forwarding with the Multicast Protocol
+ *         for Low power and lossy networks (MPL)
+ *
+ *         Packets sent to a multicast address of realm-local scope
+ *         (ff03::/16) carry an MPL hop-by-hop option holding the
+ *         sequence number of the seed that originated them. Every node
+ *         keeps a small window of the messages it has seen from each
+ *         seed and retransmits new ones on the local link under the
+ *         control of a Trickle timer, so that the packet reaches the
+ *         whole mesh without being unicast to every node.
+ *
+ *         Only proactive forwarding is done, MPL control messages are
+ *         not sent nor understood. The seed is identified by the IPv6
+ *         source address of the packet.
+ */
+
+#ifndef UIP_MPL_H
+#define UIP_MPL_H
+
+#include "net/uip.h"
+
+/* The number of messages that are kept for retransmission and
+   duplicate detection. */
+#ifdef UIP_MPL_CONF_BUFFERED_MESSAGES
+#define UIP_MPL_BUFFERED_MESSAGES UIP_MPL_CONF_BUFFERED_MESSAGES
+#else /* UIP_MPL_CONF_BUFFERED_MESSAGES */
+#define UIP_MPL_BUFFERED_MESSAGES 2
+#endif /* UIP_MPL_CONF_BUFFERED_MESSAGES */
+
+/* The number of seeds whose sequence window is remembered. */
+#ifdef UIP_MPL_CONF_SEEDS
+#define UIP_MPL_SEEDS UIP_MPL_CONF_SEEDS
+#else /* UIP_MPL_CONF_SEEDS */
+#define UIP_MPL_SEEDS 4
+#endif /* UIP_MPL_CONF_SEEDS */
+
+/* Larger messages are delivered but not forwarded. */
+#ifdef UIP_MPL_CONF_BUFSIZE
+#define UIP_MPL_BUFSIZE UIP_MPL_CONF_BUFSIZE
+#else /* UIP_MPL_CONF_BUFSIZE */
+#define UIP_MPL_BUFSIZE (UIP_BUFSIZE - UIP_LLH_LEN)
+#endif /* UIP_MPL_CONF_BUFSIZE */
+
+/* Trickle parameters of a buffered message: the smallest interval,
+   how many times it is doubled, the redundancy constant and the
+   number of intervals after which the message is no longer sent. */
+#ifdef UIP_MPL_CONF_IMIN
+#define UIP_MPL_IMIN UIP_MPL_CONF_IMIN
+#else /* UIP_MPL_CONF_IMIN */
+#define UIP_MPL_IMIN (CLOCK_SECOND / 4)
+#endif /* UIP_MPL_CONF_IMIN */
+
+#ifdef UIP_MPL_CONF_IMAX_DOUBLINGS
+#define UIP_MPL_IMAX_DOUBLINGS UIP_MPL_CONF_IMAX_DOUBLINGS
+#else /* UIP_MPL_CONF_IMAX_DOUBLINGS */
+#define UIP_MPL_IMAX_DOUBLINGS 1
+#endif /* UIP_MPL_CONF_IMAX_DOUBLINGS */
+
+#ifdef UIP_MPL_CONF_K
+#define UIP_MPL_K UIP_MPL_CONF_K
+#else /* UIP_MPL_CONF_K */
+#define UIP_MPL_K 1
+#endif /* UIP_MPL_CONF_K */
+
+#ifdef UIP_MPL_CONF_EXPIRATIONS
+#define UIP_MPL_EXPIRATIONS UIP_MPL_CONF_EXPIRATIONS
+#else /* UIP_MPL_CONF_EXPIRATIONS */
+#define UIP_MPL_EXPIRATIONS 3
+#endif /* UIP_MPL_CONF_EXPIRATIONS */
+
+/* How long a seed is remembered after its last message, in seconds. */
+#ifdef UIP_MPL_CONF_SEED_LIFETIME
+#define UIP_MPL_SEED_LIFETIME UIP_MPL_CONF_SEED_LIFETIME
+#else /* UIP_MPL_CONF_SEED_LIFETIME */
+#define UIP_MPL_SEED_LIFETIME 1800
+#endif /* UIP_MPL_CONF_SEED_LIFETIME */
+
+/* Multicast addresses of this scope are forwarded. */
+#define uip_mpl_is_addr_realm(a)                \
+  ((a)->u8[0] == 0xff && ((a)->u8[1] & 0x0f) == 3)
+
+/* Return values of uip_mpl_in(). */
+#define UIP_MPL_ACCEPT 0
+#define UIP_MPL_DROP   1
+
+void uip_mpl_init(void);
+
+/**
+ * Adds the MPL option to the realm-local multicast packet in uip_buf
+ * and keeps a copy of it for retransmission. Returns 0 if the packet
+ * must not be sent.
+ */
+uint8_t uip_mpl_out(void);
+
+/**
+ * Called by uip_process() for realm-local multicast packets. New
+ * messages are buffered for forwarding. Returns UIP_MPL_ACCEPT if the
+ * packet is new and this node is a member of the group, UIP_MPL_DROP
+ * otherwise.
+ */
+uint8_t uip_mpl_in(void);
+
+#endif /* UIP_MPL_H */
@@ -1,13 +1,14 @@
 #include <stdio.h>
+#include <string.h>
 
 #include "net/uip.h"
+#include "net/tcpip.h"
 
 #include "lib/memb.h"
 
 #include "net/uip-packetqueue.h"
 
-#define MAX_NUM_QUEUED_PACKETS 2
-MEMB(packets_memb, struct uip_packetqueue_packet, MAX_NUM_QUEUED_PACKETS);
+MEMB(packets_memb, struct uip_packetqueue_packet, UIP_PACKETQUEUE_NB);
 
 #define DEBUG 0
 #if DEBUG
@@ -17,15 +18,32 @@ MEMB(packets_memb, struct uip_packetqueue_packet, MAX_NUM_QUEUED_PACKETS);
 #define PRINTF(...)
 #endif
 
+/*---------------------------------------------------------------------------*/
+static void
+packet_remove(struct uip_packetqueue_packet *p)
+{
+  struct uip_packetqueue_handle *h = p->handle;
+  struct uip_packetqueue_packet **pp;
+
+  for(pp = &h->packet; *pp != NULL; pp = &(*pp)->next) {
+    if(*pp == p) {
+      *pp = p->next;
+      --h->len;
+      break;
+    }
+  }
+  ctimer_stop(&p->lifetimer);
+  memb_free(&packets_memb, p);
+}
 /*---------------------------------------------------------------------------*/
 static void
 packet_timedout(void *ptr)
 {
-  struct uip_packetqueue_handle *h = ptr;
+  struct uip_packetqueue_packet *p = ptr;
 
-  PRINTF("uip_packetqueue_free timed out %p\n", h);
-  memb_free(&packets_memb, h->packet);
-  h->packet = NULL;
+  PRINTF("uip_packetqueue_free timed out %p\n", p->handle);
+  UIP_STAT(++uip_stat.nd6.unresolved);
+  packet_remove(p);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -33,35 +51,89 @@ uip_packetqueue_new(struct uip_packetqueue_handle *handle)
 {
   PRINTF("uip_packetqueue_new %p\n", handle);
   handle->packet = NULL;
+  handle->len = 0;
 }
 /*---------------------------------------------------------------------------*/
 struct uip_packetqueue_packet *
 uip_packetqueue_alloc(struct uip_packetqueue_handle *handle, clock_time_t lifetime)
 {
+  struct uip_packetqueue_packet *p, **pp;
+
   PRINTF("uip_packetqueue_alloc %p\n", handle);
-  if(handle->packet != NULL) {
-    PRINTF("alloced\n");
+  if(handle->len >= UIP_PACKETQUEUE_PER_HANDLE) {
+    PRINTF("full\n");
     return NULL;
   }
-  handle->packet = memb_alloc(&packets_memb);
-  if(handle->packet != NULL) {
-    ctimer_set(&handle->packet->lifetimer, lifetime,
-               packet_timedout, handle);
-  } else {
+  p = memb_alloc(&packets_memb);
+  if(p == NULL) {
     PRINTF("uip_packetqueue_alloc failed\n");
+    return NULL;
   }
-  return handle->packet;
+  p->next = NULL;
+  p->handle = handle;
+  p->queue_buf_len = 0;
+  for(pp = &handle->packet; *pp != NULL; pp = &(*pp)->next);
+  *pp = p;
+  ++handle->len;
+  ctimer_set(&p->lifetimer, lifetime, packet_timedout, p);
+  return p;
 }
 /*---------------------------------------------------------------------------*/
 void
 uip_packetqueue_free(struct uip_packetqueue_handle *handle)
 {
   PRINTF("uip_packetqueue_free %p\n", handle);
-  if(handle->packet != NULL) {
-    ctimer_stop(&handle->packet->lifetimer);
-    memb_free(&packets_memb, handle->packet);
-    handle->packet = NULL;
+  while(handle->packet != NULL) {
+    packet_remove(handle->packet);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_packetqueue_flush(struct uip_packetqueue_handle *handle,
+                      uip_lladdr_t *lladdr)
+{
+  while(handle->packet != NULL) {
+    uip_len = handle->packet->queue_buf_len;
+    memcpy(&uip_buf[UIP_LLH_LEN], handle->packet->queue_buf, uip_len);
+    packet_remove(handle->packet);
+    tcpip_output(lladdr);
   }
+  uip_len = 0;
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_packetqueue_send(struct uip_packetqueue_handle *handle,
+                     uip_lladdr_t *lladdr)
+{
+  struct uip_packetqueue_packet *p, **pp;
+  uint16_t i, len;
+  uint8_t c;
+
+  p = handle->packet;
+  if(p != NULL) {
+    /* Swap the packet in uip_buf with the oldest queued one, which
+       can then be sent, and move it to the end of the queue. This
+       needs no free packet in the pool. */
+    len = p->queue_buf_len > uip_len ? p->queue_buf_len : uip_len;
+    for(i = 0; i < len; ++i) {
+      c = uip_buf[UIP_LLH_LEN + i];
+      uip_buf[UIP_LLH_LEN + i] = p->queue_buf[i];
+      p->queue_buf[i] = c;
+    }
+    len = uip_len;
+    uip_len = p->queue_buf_len;
+    p->queue_buf_len = len;
+
+    if(p->next != NULL) {
+      handle->packet = p->next;
+      p->next = NULL;
+      for(pp = &handle->packet; *pp != NULL; pp = &(*pp)->next);
+      *pp = p;
+    }
+    ctimer_restart(&p->lifetimer);
+  }
+  tcpip_output(lladdr);
+  uip_packetqueue_flush(handle, lladdr);
 }
 /*---------------------------------------------------------------------------*/
 uint8_t *
@@ -76,11 +148,3 @@ uip_packetqueue_buflen(struct uip_packetqueue_handle *h)
   return h->packet != NULL? h->packet->queue_buf_len: 0;
 }
 /*---------------------------------------------------------------------------*/
-void
-uip_packetqueue_set_buflen(struct uip_packetqueue_handle *h, uint16_t len)
-{
-  if(h->packet != NULL) {
-    h->packet->queue_buf_len = len;
-  }
-}
-/*---------------------------------------------------------------------------*/
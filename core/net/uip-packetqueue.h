@@ -3,10 +3,25 @@
 
 #include "sys/ctimer.h"
 
+/* Packets waiting for a neighbor are taken from a pool shared by all
+   neighbors, and each neighbor may hold at most
+   UIP_PACKETQUEUE_PER_HANDLE of them. */
+#ifdef UIP_CONF_PACKETQUEUE_NB
+#define UIP_PACKETQUEUE_NB UIP_CONF_PACKETQUEUE_NB
+#else /* UIP_CONF_PACKETQUEUE_NB */
+#define UIP_PACKETQUEUE_NB 2
+#endif /* UIP_CONF_PACKETQUEUE_NB */
+
+#ifdef UIP_CONF_PACKETQUEUE_PER_HANDLE
+#define UIP_PACKETQUEUE_PER_HANDLE UIP_CONF_PACKETQUEUE_PER_HANDLE
+#else /* UIP_CONF_PACKETQUEUE_PER_HANDLE */
+#define UIP_PACKETQUEUE_PER_HANDLE UIP_PACKETQUEUE_NB
+#endif /* UIP_CONF_PACKETQUEUE_PER_HANDLE */
+
 struct uip_packetqueue_handle;
 
 struct uip_packetqueue_packet {
-  struct uip_ds6_queued_packet *next;
+  struct uip_packetqueue_packet *next;
   uint8_t queue_buf[UIP_BUFSIZE - UIP_LLH_LEN];
   uint16_t queue_buf_len;
   struct ctimer lifetimer;
@@ -15,21 +30,35 @@ struct uip_packetqueue_packet {
 
 struct uip_packetqueue_handle {
   struct uip_packetqueue_packet *packet;
+  uint8_t len;
 };
 
 void uip_packetqueue_new(struct uip_packetqueue_handle *handle);
 
-
+/* Adds a packet at the end of the queue. Returns NULL if the queue is
+   full or the pool is empty. The packet is dropped after lifetime. */
 struct uip_packetqueue_packet *
 uip_packetqueue_alloc(struct uip_packetqueue_handle *handle, clock_time_t lifetime);
 
-
+/* Frees all packets in the queue. */
 void
 uip_packetqueue_free(struct uip_packetqueue_handle *handle);
 
+/* Sends all packets in the queue to lladdr with tcpip_output(), in the
+   order they were queued. Overwrites uip_buf. */
+void uip_packetqueue_flush(struct uip_packetqueue_handle *handle,
+                           uip_lladdr_t *lladdr);
+
+/* Sends the packets in the queue and then the packet in uip_buf to
+   lladdr with tcpip_output(), so that the packet in uip_buf does not
+   overtake the queued ones. Overwrites uip_buf. */
+void uip_packetqueue_send(struct uip_packetqueue_handle *handle,
+                          uip_lladdr_t *lladdr);
+
+/* The first packet in the queue. */
 uint8_t *uip_packetqueue_buf(struct uip_packetqueue_handle *h);
 uint16_t uip_packetqueue_buflen(struct uip_packetqueue_handle *h);
-void uip_packetqueue_set_buflen(struct uip_packetqueue_handle *h, uint16_t len);
 
+#define uip_packetqueue_len(h) ((h)->len)
 
 #endif /* UIP_PACKETQUEUE_H */
@@ -49,12 +49,23 @@ extern u16_t uip_slen;
 
 /*---------------------------------------------------------------------------*/
 void
-uip_udp_packet_send(struct uip_udp_conn *c, const void *data, int len)
+uip_udp_packet_sendv(struct uip_udp_conn *c,
+		     const struct uip_udp_iovec *iov, int iovcnt)
 {
 #if UIP_UDP
+  uint8_t *dst = &uip_buf[UIP_LLH_LEN + UIP_IPUDPH_LEN];
+  int room = UIP_BUFSIZE - UIP_LLH_LEN - UIP_IPUDPH_LEN;
+  int len;
+
   uip_udp_conn = c;
-  uip_slen = len;
-  memcpy(&uip_buf[UIP_LLH_LEN + UIP_IPUDPH_LEN], data, len > UIP_BUFSIZE? UIP_BUFSIZE: len);
+  uip_slen = 0;
+  for(; iovcnt > 0 && room > 0; iov++, iovcnt--) {
+    len = iov->len > room? room: iov->len;
+    memcpy(dst, iov->data, len);
+    dst += len;
+    room -= len;
+    uip_slen += len;
+  }
   uip_process(UIP_UDP_SEND_CONN);
 #if UIP_CONF_IPV6 //math
   tcpip_ipv6_output();
@@ -68,8 +79,19 @@ uip_udp_packet_send(struct uip_udp_conn *c, const void *data, int len)
 }
 /*---------------------------------------------------------------------------*/
 void
-uip_udp_packet_sendto(struct uip_udp_conn *c, const void *data, int len,
-		      const uip_ipaddr_t *toaddr, uint16_t toport)
+uip_udp_packet_send(struct uip_udp_conn *c, const void *data, int len)
+{
+  struct uip_udp_iovec iov;
+
+  iov.data = data;
+  iov.len = len;
+  uip_udp_packet_sendv(c, &iov, 1);
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_udp_packet_sendtov(struct uip_udp_conn *c,
+		       const struct uip_udp_iovec *iov, int iovcnt,
+		       const uip_ipaddr_t *toaddr, uint16_t toport)
 {
   uip_ipaddr_t curaddr;
   uint16_t curport;
@@ -82,10 +104,21 @@ uip_udp_packet_sendto(struct uip_udp_conn *c, const void *data, int len,
   uip_ipaddr_copy(&c->ripaddr, toaddr);
   c->rport = toport;
 
-  uip_udp_packet_send(c, data, len);
+  uip_udp_packet_sendv(c, iov, iovcnt);
 
   /* Restore old IP addr/port */
   uip_ipaddr_copy(&c->ripaddr, &curaddr);
   c->rport = curport;
 }
 /*---------------------------------------------------------------------------*/
+void
+uip_udp_packet_sendto(struct uip_udp_conn *c, const void *data, int len,
+		      const uip_ipaddr_t *toaddr, uint16_t toport)
+{
+  struct uip_udp_iovec iov;
+
+  iov.data = data;
+  iov.len = len;
+  uip_udp_packet_sendtov(c, &iov, 1, toaddr, toport);
+}
+/*---------------------------------------------------------------------------*/
@@ -43,8 +43,23 @@
 
 #include "net/uip.h"
 
+/* A piece of the payload given to uip_udp_packet_sendv(). */
+struct uip_udp_iovec {
+  const void *data;
+  int len;
+};
+
 void uip_udp_packet_send(struct uip_udp_conn *c, const void *data, int len);
 void uip_udp_packet_sendto(struct uip_udp_conn *c, const void *data, int len,
 			   const uip_ipaddr_t *toaddr, uint16_t toport);
 
+/* Send the iovcnt pieces of iov one after the other as the payload
+   of a single packet. Each piece is copied straight into uip_buf, so
+   a header and a body need not be put together in a buffer first. */
+void uip_udp_packet_sendv(struct uip_udp_conn *c,
+			  const struct uip_udp_iovec *iov, int iovcnt);
+void uip_udp_packet_sendtov(struct uip_udp_conn *c,
+			    const struct uip_udp_iovec *iov, int iovcnt,
+			    const uip_ipaddr_t *toaddr, uint16_t toport);
+
 #endif /* __UIP_UDP_PACKET_H__ */
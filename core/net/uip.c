@@ -367,6 +367,77 @@ uip_udpchksum(void)
 #endif /* UIP_UDP_CHECKSUMS */
 #endif /* UIP_ARCH_CHKSUM */
 /*---------------------------------------------------------------------------*/
+#if UIP_CONN_HASH
+/* Each hash bucket is kept in the order of the connection table, so
+   that the first match is the one a scan of the table would find. */
+#if UIP_TCP
+static struct uip_conn *tcp_hash[UIP_CONN_HASH];
+
+#define TCP_HASH(lport, rport, addr)                                    \
+  (((lport) ^ (rport) ^ (addr)->u16[sizeof(uip_ipaddr_t) / 2 - 1]) %    \
+   UIP_CONN_HASH)
+
+/* Sets the ports and remote address of conn and moves it to the
+   matching bucket. Closed connections are left in their bucket until
+   they are reused, and are skipped when looking up. */
+static void
+tcp_conn_set(struct uip_conn *conn, u16_t lport, u16_t rport,
+             uip_ipaddr_t *ripaddr)
+{
+  struct uip_conn **p;
+
+  for(p = &tcp_hash[TCP_HASH(conn->lport, conn->rport, &conn->ripaddr)];
+      *p != NULL; p = &(*p)->hnext) {
+    if(*p == conn) {
+      *p = conn->hnext;
+      break;
+    }
+  }
+  conn->lport = lport;
+  conn->rport = rport;
+  uip_ipaddr_copy(&conn->ripaddr, ripaddr);
+  for(p = &tcp_hash[TCP_HASH(lport, rport, ripaddr)];
+      *p != NULL && *p < conn; p = &(*p)->hnext);
+  conn->hnext = *p;
+  *p = conn;
+}
+#endif /* UIP_TCP */
+
+#if UIP_UDP
+static struct uip_udp_conn *udp_hash[UIP_CONN_HASH];
+
+#define UDP_HASH(lport) (((lport) ^ ((lport) >> 8)) % UIP_CONN_HASH)
+
+void
+uip_udp_bind_port(struct uip_udp_conn *conn, u16_t port)
+{
+  struct uip_udp_conn **p;
+
+  if(conn->lport != 0) {
+    for(p = &udp_hash[UDP_HASH(conn->lport)]; *p != NULL; p = &(*p)->hnext) {
+      if(*p == conn) {
+        *p = conn->hnext;
+        break;
+      }
+    }
+  }
+  conn->lport = port;
+  if(port != 0) {
+    for(p = &udp_hash[UDP_HASH(port)];
+        *p != NULL && *p < conn; p = &(*p)->hnext);
+    conn->hnext = *p;
+    *p = conn;
+  }
+}
+#endif /* UIP_UDP */
+#else /* UIP_CONN_HASH */
+#define tcp_conn_set(conn, l, r, addr) do {     \
+    (conn)->lport = (l);                        \
+    (conn)->rport = (r);                        \
+    uip_ipaddr_copy(&(conn)->ripaddr, (addr));  \
+  } while(0)
+#endif /* UIP_CONN_HASH */
+/*---------------------------------------------------------------------------*/
 void
 uip_init(void)
 {
@@ -376,6 +447,9 @@ uip_init(void)
   for(c = 0; c < UIP_CONNS; ++c) {
     uip_conns[c].tcpstateflags = UIP_CLOSED;
   }
+#if UIP_CONN_HASH
+  memset(tcp_hash, 0, sizeof(tcp_hash));
+#endif /* UIP_CONN_HASH */
 #if UIP_ACTIVE_OPEN || UIP_UDP
   lastport = 1024;
 #endif /* UIP_ACTIVE_OPEN || UIP_UDP */
@@ -384,6 +458,9 @@ uip_init(void)
   for(c = 0; c < UIP_UDP_CONNS; ++c) {
     uip_udp_conns[c].lport = 0;
   }
+#if UIP_CONN_HASH
+  memset(udp_hash, 0, sizeof(udp_hash));
+#endif /* UIP_CONN_HASH */
 #endif /* UIP_UDP */
   
 
@@ -452,9 +529,7 @@ uip_connect(uip_ipaddr_t *ripaddr, u16_t rport)
   conn->rto = UIP_RTO;
   conn->sa = 0;
   conn->sv = 16;   /* Initial value of the RTT variance. */
-  conn->lport = uip_htons(lastport);
-  conn->rport = rport;
-  uip_ipaddr_copy(&conn->ripaddr, ripaddr);
+  tcp_conn_set(conn, uip_htons(lastport), rport, ripaddr);
   
   return conn;
 }
@@ -493,7 +568,7 @@ uip_udp_new(const uip_ipaddr_t *ripaddr, u16_t rport)
     return 0;
   }
   
-  conn->lport = UIP_HTONS(lastport);
+  uip_udp_bind(conn, UIP_HTONS(lastport));
   conn->rport = rport;
   if(ripaddr == NULL) {
     memset(&conn->ripaddr, 0, sizeof(uip_ipaddr_t));
@@ -1112,9 +1187,15 @@ uip_process(u8_t flag)
   }
 
   /* Demultiplex this UDP packet between the UDP "connections". */
+#if UIP_CONN_HASH
+  for(uip_udp_conn = udp_hash[UDP_HASH(UDPBUF->destport)];
+      uip_udp_conn != NULL;
+      uip_udp_conn = uip_udp_conn->hnext) {
+#else /* UIP_CONN_HASH */
   for(uip_udp_conn = &uip_udp_conns[0];
       uip_udp_conn < &uip_udp_conns[UIP_UDP_CONNS];
       ++uip_udp_conn) {
+#endif /* UIP_CONN_HASH */
     /* If the local UDP port is non-zero, the connection is considered
        to be used. If so, the local port number is checked against the
        destination port number in the received packet. If the two port
@@ -1235,8 +1316,14 @@ uip_process(u8_t flag)
   
   /* Demultiplex this segment. */
   /* First check any active connections. */
+#if UIP_CONN_HASH
+  for(uip_connr = tcp_hash[TCP_HASH(BUF->destport, BUF->srcport,
+                                    &BUF->srcipaddr)];
+      uip_connr != NULL; uip_connr = uip_connr->hnext) {
+#else /* UIP_CONN_HASH */
   for(uip_connr = &uip_conns[0]; uip_connr <= &uip_conns[UIP_CONNS - 1];
       ++uip_connr) {
+#endif /* UIP_CONN_HASH */
     if(uip_connr->tcpstateflags != UIP_CLOSED &&
        BUF->destport == uip_connr->lport &&
        BUF->srcport == uip_connr->rport &&
@@ -1355,9 +1442,7 @@ uip_process(u8_t flag)
   uip_connr->sa = 0;
   uip_connr->sv = 4;
   uip_connr->nrtx = 0;
-  uip_connr->lport = BUF->destport;
-  uip_connr->rport = BUF->srcport;
-  uip_ipaddr_copy(&uip_connr->ripaddr, &BUF->srcipaddr);
+  tcp_conn_set(uip_connr, BUF->destport, BUF->srcport, &BUF->srcipaddr);
   uip_connr->tcpstateflags = UIP_SYN_RCVD;
 
   uip_connr->snd_nxt[0] = iss[0];
@@ -837,7 +837,11 @@ struct uip_udp_conn *uip_udp_new(const uip_ipaddr_t *ripaddr, u16_t rport);
  *
  * \hideinitializer
  */
+#if UIP_CONN_HASH
+#define uip_udp_remove(conn) uip_udp_bind_port(conn, 0)
+#else /* UIP_CONN_HASH */
 #define uip_udp_remove(conn) (conn)->lport = 0
+#endif /* UIP_CONN_HASH */
 
 /**
  * Bind a UDP connection to a local port.
@@ -849,7 +853,12 @@ struct uip_udp_conn *uip_udp_new(const uip_ipaddr_t *ripaddr, u16_t rport);
  *
  * \hideinitializer
  */
+#if UIP_CONN_HASH
+#define uip_udp_bind(conn, port) uip_udp_bind_port(conn, port)
+void uip_udp_bind_port(struct uip_udp_conn *conn, u16_t port);
+#else /* UIP_CONN_HASH */
 #define uip_udp_bind(conn, port) (conn)->lport = port
+#endif /* UIP_CONN_HASH */
 
 /**
  * Send a UDP datagram of length len on the current connection.
@@ -1313,6 +1322,10 @@ struct uip_conn {
   u8_t timer;         /**< The retransmission timer. */
   u8_t nrtx;          /**< The number of retransmissions for the last
 			 segment sent. */
+#if UIP_CONN_HASH
+  struct uip_conn *hnext; /**< The next connection in the same hash
+			     bucket. */
+#endif /* UIP_CONN_HASH */
 
   /** The application state. */
   uip_tcp_appstate_t appstate;
@@ -1351,6 +1364,10 @@ struct uip_udp_conn {
   u16_t lport;        /**< The local port number in network byte order. */
   u16_t rport;        /**< The remote port number in network byte order. */
   u8_t  ttl;          /**< Default time-to-live. */
+#if UIP_CONN_HASH
+  struct uip_udp_conn *hnext; /**< The next connection bound to a
+				 port in the same hash bucket. */
+#endif /* UIP_CONN_HASH */
 
   /** The application state. */
   uip_udp_appstate_t appstate;
@@ -1454,7 +1471,37 @@ struct uip_stats {
     uip_stats_t drop;     /**< Number of dropped ND6 packets. */
     uip_stats_t recv;     /**< Number of recived ND6 packets */
     uip_stats_t sent;     /**< Number of sent ND6 packets */
+    uip_stats_t qdrop;    /**< Number of packets dropped because there
+			     was no room to queue them while their
+			     neighbor was being resolved */
+    uip_stats_t unresolved; /**< Number of queued packets dropped
+			       because their neighbor was not
+			       resolved in time */
   } nd6;
+#if UIP_CONF_IPV6_REASSEMBLY
+  struct {
+    uip_stats_t recv;     /**< Number of received fragments. */
+    uip_stats_t reassembled; /**< Number of packets reassembled. */
+    uip_stats_t timeout;  /**< Number of packets given up because
+			     not all fragments arrived in time. */
+    uip_stats_t drop;     /**< Number of fragments dropped because
+			     no context was free or the packet was
+			     malformed. */
+  } reass;
+#endif /* UIP_CONF_IPV6_REASSEMBLY */
+#if UIP_CONF_IPV6_MULTICAST
+  struct {
+    uip_stats_t sent;     /**< Number of realm-local multicast packets
+			     originated. */
+    uip_stats_t recv;     /**< Number of new MPL messages received. */
+    uip_stats_t dup;      /**< Number of copies of known messages
+			     received. */
+    uip_stats_t fwd;      /**< Number of messages retransmitted,
+			     originated ones included. */
+    uip_stats_t drop;     /**< Number of messages dropped for lack of
+			     room. */
+  } mpl;
+#endif /* UIP_CONF_IPV6_MULTICAST */
 #endif /*UIP_CONF_IPV6*/
 };
 
@@ -1840,6 +1887,7 @@ struct uip_udp_hdr {
 /** \brief  Destination and Hop By Hop extension headers option types */
 #define UIP_EXT_HDR_OPT_PAD1  0
 #define UIP_EXT_HDR_OPT_PADN  1
+#define UIP_EXT_HDR_OPT_MPL   0x6d
 /** @} */
 
 /** @{ */
@@ -76,6 +76,9 @@
 #include "net/uip-icmp6.h"
 #include "net/uip-nd6.h"
 #include "net/uip-ds6.h"
+#if UIP_CONF_IPV6_MULTICAST
+#include "net/uip-mpl.h"
+#endif /* UIP_CONF_IPV6_MULTICAST */
 
 #include <string.h>
 
@@ -151,7 +154,7 @@ u8_t uip_ext_opt_offset = 0;
 /** \name Buffer defines
  *  @{
  */
-#define FBUF                             ((struct uip_tcpip_hdr *)&uip_reassbuf[0])
+#define FBUF(c)                          ((struct uip_tcpip_hdr *)&(c)->buf[0])
 #define UIP_IP_BUF                          ((struct uip_ip_hdr *)&uip_buf[UIP_LLH_LEN])
 #define UIP_ICMP_BUF                      ((struct uip_icmp_hdr *)&uip_buf[uip_l2_l3_hdr_len])
 #define UIP_UDP_BUF                        ((struct uip_udp_hdr *)&uip_buf[uip_l2_l3_hdr_len])
@@ -402,11 +405,85 @@ uip_udpchksum(void)
 #endif /* UIP_UDP && UIP_UDP_CHECKSUMS */
 #endif /* UIP_ARCH_CHKSUM */
 /*---------------------------------------------------------------------------*/
+#if UIP_CONN_HASH
+/* Each hash bucket is kept in the order of the connection table, so
+   that the first match is the one a scan of the table would find. */
+#if UIP_TCP
+static struct uip_conn *tcp_hash[UIP_CONN_HASH];
+
+#define TCP_HASH(lport, rport, addr)                                    \
+  (((lport) ^ (rport) ^ (addr)->u16[sizeof(uip_ipaddr_t) / 2 - 1]) %    \
+   UIP_CONN_HASH)
+
+/* Sets the ports and remote address of conn and moves it to the
+   matching bucket. Closed connections are left in their bucket until
+   they are reused, and are skipped when looking up. */
+static void
+tcp_conn_set(struct uip_conn *conn, u16_t lport, u16_t rport,
+             uip_ipaddr_t *ripaddr)
+{
+  struct uip_conn **p;
+
+  for(p = &tcp_hash[TCP_HASH(conn->lport, conn->rport, &conn->ripaddr)];
+      *p != NULL; p = &(*p)->hnext) {
+    if(*p == conn) {
+      *p = conn->hnext;
+      break;
+    }
+  }
+  conn->lport = lport;
+  conn->rport = rport;
+  uip_ipaddr_copy(&conn->ripaddr, ripaddr);
+  for(p = &tcp_hash[TCP_HASH(lport, rport, ripaddr)];
+      *p != NULL && *p < conn; p = &(*p)->hnext);
+  conn->hnext = *p;
+  *p = conn;
+}
+#endif /* UIP_TCP */
+
+#if UIP_UDP
+static struct uip_udp_conn *udp_hash[UIP_CONN_HASH];
+
+#define UDP_HASH(lport) (((lport) ^ ((lport) >> 8)) % UIP_CONN_HASH)
+
+void
+uip_udp_bind_port(struct uip_udp_conn *conn, u16_t port)
+{
+  struct uip_udp_conn **p;
+
+  if(conn->lport != 0) {
+    for(p = &udp_hash[UDP_HASH(conn->lport)]; *p != NULL; p = &(*p)->hnext) {
+      if(*p == conn) {
+        *p = conn->hnext;
+        break;
+      }
+    }
+  }
+  conn->lport = port;
+  if(port != 0) {
+    for(p = &udp_hash[UDP_HASH(port)];
+        *p != NULL && *p < conn; p = &(*p)->hnext);
+    conn->hnext = *p;
+    *p = conn;
+  }
+}
+#endif /* UIP_UDP */
+#else /* UIP_CONN_HASH */
+#define tcp_conn_set(conn, l, r, addr) do {     \
+    (conn)->lport = (l);                        \
+    (conn)->rport = (r);                        \
+    uip_ipaddr_copy(&(conn)->ripaddr, (addr));  \
+  } while(0)
+#endif /* UIP_CONN_HASH */
+/*---------------------------------------------------------------------------*/
 void
 uip_init(void)
 {
    
   uip_ds6_init();
+#if UIP_CONF_IPV6_MULTICAST
+  uip_mpl_init();
+#endif /* UIP_CONF_IPV6_MULTICAST */
 
 #if UIP_TCP
   for(c = 0; c < UIP_LISTENPORTS; ++c) {
@@ -415,6 +492,9 @@ uip_init(void)
   for(c = 0; c < UIP_CONNS; ++c) {
     uip_conns[c].tcpstateflags = UIP_CLOSED;
   }
+#if UIP_CONN_HASH
+  memset(tcp_hash, 0, sizeof(tcp_hash));
+#endif /* UIP_CONN_HASH */
 #endif /* UIP_TCP */
 
 #if UIP_ACTIVE_OPEN || UIP_UDP
@@ -425,6 +505,9 @@ uip_init(void)
   for(c = 0; c < UIP_UDP_CONNS; ++c) {
     uip_udp_conns[c].lport = 0;
   }
+#if UIP_CONN_HASH
+  memset(udp_hash, 0, sizeof(udp_hash));
+#endif /* UIP_CONN_HASH */
 #endif /* UIP_UDP */
 }
 
@@ -487,9 +570,7 @@ uip_connect(uip_ipaddr_t *ripaddr, u16_t rport)
   conn->rto = UIP_RTO;
   conn->sa = 0;
   conn->sv = 16;   /* Initial value of the RTT variance. */
-  conn->lport = uip_htons(lastport);
-  conn->rport = rport;
-  uip_ipaddr_copy(&conn->ripaddr, ripaddr);
+  tcp_conn_set(conn, uip_htons(lastport), rport, ripaddr);
   
   return conn;
 }
@@ -530,7 +611,7 @@ uip_udp_new(const uip_ipaddr_t *ripaddr, u16_t rport)
     return 0;
   }
   
-  conn->lport = UIP_HTONS(lastport);
+  uip_udp_bind(conn, UIP_HTONS(lastport));
   conn->rport = rport;
   if(ripaddr == NULL) {
     memset(&conn->ripaddr, 0, sizeof(uip_ipaddr_t));
@@ -576,14 +657,28 @@ uip_listen(u16_t port)
 #if UIP_CONF_IPV6_REASSEMBLY
 #define UIP_REASS_BUFSIZE (UIP_BUFSIZE - UIP_LLH_LEN)
 
-static u8_t uip_reassbuf[UIP_REASS_BUFSIZE];
+/*
+ * One reassembly context per fragmented packet being received, so that
+ * fragments of different packets may arrive interleaved. A context is
+ * identified by the source and destination addresses and the fragment
+ * identification of the packet.
+ */
+struct uip_reass_ctx {
+  u8_t buf[UIP_REASS_BUFSIZE];
+  u8_t bitmap[UIP_REASS_BUFSIZE / (8 * 8) + 1];
+  /*the first byte of an IP fragment is aligned on an 8-byte boundary */
+  struct timer timer;
+  u32_t id;
+  u16_t len;
+  u8_t flags;
+  u8_t on;
+};
 
-static u8_t uip_reassbitmap[UIP_REASS_BUFSIZE / (8 * 8)];
-/*the first byte of an IP fragment is aligned on an 8-byte boundary */
+static struct uip_reass_ctx uip_reass_ctxs[UIP_CONF_IPV6_REASS_NB];
 
 static const u8_t bitmap_bits[8] = {0xff, 0x7f, 0x3f, 0x1f,
                                     0x0f, 0x07, 0x03, 0x01};
-static u16_t uip_reasslen;
+/* flags of the context that handled the last fragment */
 static u8_t uip_reassflags;
 
 #define UIP_REASS_FLAG_LASTFRAG 0x01
@@ -601,156 +696,198 @@ static u8_t uip_reassflags;
  */
 
 
-struct etimer uip_reass_timer; /* timer for reassembly */
-u8_t uip_reass_on; /* equal to 1 if we are currently reassembling a packet */
+struct etimer uip_reass_timer; /* expires with the oldest context */
 
-static u32_t uip_id; /* For every packet that is to be fragmented, the source
-                        node generates an Identification value that is present
-                        in all the fragments */
 #define IP_MF   0x0001
 
+/*---------------------------------------------------------------------------*/
+static void
+uip_reass_timer_update(void)
+{
+  struct uip_reass_ctx *c;
+  clock_time_t remaining, next;
+  u8_t on = 0;
+
+  next = 0;
+  for(c = uip_reass_ctxs;
+      c < uip_reass_ctxs + UIP_CONF_IPV6_REASS_NB; c++) {
+    if(c->on) {
+      remaining = timer_expired(&c->timer) ? 1 : timer_remaining(&c->timer);
+      if(!on || remaining < next) {
+        next = remaining;
+      }
+      on = 1;
+    }
+  }
+  if(on) {
+    etimer_set(&uip_reass_timer, next);
+  } else {
+    etimer_stop(&uip_reass_timer);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+uip_reass_ctx_free(struct uip_reass_ctx *c)
+{
+  c->on = 0;
+  uip_reass_timer_update();
+}
+/*---------------------------------------------------------------------------*/
 static u16_t
 uip_reass(void)
 {
+  struct uip_reass_ctx *c, *free;
   u16_t offset=0;
   u16_t len;
   u16_t i;
-  
-  /* If ip_reasstmr is zero, no packet is present in the buffer */
+
+  UIP_STAT(++uip_stat.reass.recv);
+
+  /* Find the context of the packet this fragment belongs to. */
+  free = NULL;
+  for(c = uip_reass_ctxs;
+      c < uip_reass_ctxs + UIP_CONF_IPV6_REASS_NB; c++) {
+    if(c->on) {
+      if(uip_ipaddr_cmp(&FBUF(c)->srcipaddr, &UIP_IP_BUF->srcipaddr) &&
+         uip_ipaddr_cmp(&FBUF(c)->destipaddr, &UIP_IP_BUF->destipaddr) &&
+         UIP_FRAG_BUF->id == c->id) {
+        break;
+      }
+    } else if(free == NULL) {
+      free = c;
+    }
+  }
+
   /* We first write the unfragmentable part of IP header into the reassembly
      buffer. The reset the other reassembly variables. */
-  if(uip_reass_on == 0) {
+  if(c == uip_reass_ctxs + UIP_CONF_IPV6_REASS_NB) {
+    if(free == NULL) {
+      PRINTF("Already reassembling %d paquets\n", UIP_CONF_IPV6_REASS_NB);
+      UIP_STAT(++uip_stat.reass.drop);
+      return 0;
+    }
     PRINTF("Starting reassembly\n");
-    memcpy(FBUF, UIP_IP_BUF, uip_ext_len + UIP_IPH_LEN);
+    c = free;
+    memcpy(FBUF(c), UIP_IP_BUF, uip_ext_len + UIP_IPH_LEN);
     /* temporary in case we do not receive the fragment with offset 0 first */
-    etimer_set(&uip_reass_timer, UIP_REASS_MAXAGE*CLOCK_SECOND);
-    uip_reass_on = 1;
-    uip_reassflags = 0;
-    uip_id = UIP_FRAG_BUF->id;
+    timer_set(&c->timer, UIP_REASS_MAXAGE*CLOCK_SECOND);
+    c->on = 1;
+    c->flags = 0;
+    c->id = UIP_FRAG_BUF->id;
     /* Clear the bitmap. */
-    memset(uip_reassbitmap, 0, sizeof(uip_reassbitmap));
+    memset(c->bitmap, 0, sizeof(c->bitmap));
+    uip_reass_timer_update();
   }
-  /*
-   * Check if the incoming fragment matches the one currently present
-   * in the reasembly buffer. If so, we proceed with copying the fragment
-   * into the buffer.
-   */
-  if(uip_ipaddr_cmp(&FBUF->srcipaddr, &UIP_IP_BUF->srcipaddr) &&
-     uip_ipaddr_cmp(&FBUF->destipaddr, &UIP_IP_BUF->destipaddr) &&
-     UIP_FRAG_BUF->id == uip_id) {
-    len = uip_len - uip_ext_len - UIP_IPH_LEN - UIP_FRAGH_LEN;
-    offset = (uip_ntohs(UIP_FRAG_BUF->offsetresmore) & 0xfff8);
-    /* in byte, originaly in multiple of 8 bytes*/
-    PRINTF("len %d\n", len);
-    PRINTF("offset %d\n", offset);
-    if(offset == 0){
-      uip_reassflags |= UIP_REASS_FLAG_FIRSTFRAG;
-      /*
-       * The Next Header field of the last header of the Unfragmentable
-       * Part is obtained from the Next Header field of the first
-       * fragment's Fragment header.
-       */
-      *uip_next_hdr = UIP_FRAG_BUF->next;
-      memcpy(FBUF, UIP_IP_BUF, uip_ext_len + UIP_IPH_LEN);
-      PRINTF("src ");
-      PRINT6ADDR(&FBUF->srcipaddr);
-      PRINTF("dest ");
-      PRINT6ADDR(&FBUF->destipaddr);
-      PRINTF("next %d\n", UIP_IP_BUF->proto);
-      
+
+  len = uip_len - uip_ext_len - UIP_IPH_LEN - UIP_FRAGH_LEN;
+  offset = (uip_ntohs(UIP_FRAG_BUF->offsetresmore) & 0xfff8);
+  /* in byte, originaly in multiple of 8 bytes*/
+  PRINTF("len %d\n", len);
+  PRINTF("offset %d\n", offset);
+  if(offset == 0){
+    c->flags |= UIP_REASS_FLAG_FIRSTFRAG;
+    /*
+     * The Next Header field of the last header of the Unfragmentable
+     * Part is obtained from the Next Header field of the first
+     * fragment's Fragment header.
+     */
+    *uip_next_hdr = UIP_FRAG_BUF->next;
+    memcpy(FBUF(c), UIP_IP_BUF, uip_ext_len + UIP_IPH_LEN);
+    PRINTF("src ");
+    PRINT6ADDR(&FBUF(c)->srcipaddr);
+    PRINTF("dest ");
+    PRINT6ADDR(&FBUF(c)->destipaddr);
+    PRINTF("next %d\n", UIP_IP_BUF->proto);
+  }
+  uip_reassflags = c->flags;
+
+  /* If the offset or the offset + fragment length overflows the
+     reassembly buffer, we discard the entire packet. */
+  if(offset > UIP_REASS_BUFSIZE ||
+     offset + len > UIP_REASS_BUFSIZE - UIP_IPH_LEN - uip_ext_len) {
+    UIP_STAT(++uip_stat.reass.drop);
+    uip_reass_ctx_free(c);
+    return 0;
+  }
+
+  /* If this fragment has the More Fragments flag set to zero, it is the
+     last fragment*/
+  if((uip_ntohs(UIP_FRAG_BUF->offsetresmore) & IP_MF) == 0) {
+    c->flags |= UIP_REASS_FLAG_LASTFRAG;
+    /*calculate the size of the entire packet*/
+    c->len = offset + len;
+    PRINTF("LAST FRAGMENT reasslen %d\n", c->len);
+  } else {
+    /* If len is not a multiple of 8 octets and the M flag of that fragment
+       is 1, then that fragment must be discarded and an ICMP Parameter
+       Problem, Code 0, message should be sent to the source of the fragment,
+       pointing to the Payload Length field of the fragment packet. */
+    if(len % 8 != 0){
+      uip_icmp6_error_output(ICMP6_PARAM_PROB, ICMP6_PARAMPROB_HEADER, 4);
+      uip_reassflags = c->flags | UIP_REASS_FLAG_ERROR_MSG;
+      /* not clear if we should interrupt reassembly, but it seems so from
+         the conformance tests */
+      UIP_STAT(++uip_stat.reass.drop);
+      uip_reass_ctx_free(c);
+      return uip_len;
     }
-    
-    /* If the offset or the offset + fragment length overflows the
-       reassembly buffer, we discard the entire packet. */
-    if(offset > UIP_REASS_BUFSIZE ||
-       offset + len > UIP_REASS_BUFSIZE) {
-      uip_reass_on = 0;
-      etimer_stop(&uip_reass_timer);
-      return 0;
+  }
+
+  /* Copy the fragment into the reassembly buffer, at the right
+     offset. */
+  memcpy((uint8_t *)FBUF(c) + UIP_IPH_LEN + uip_ext_len + offset,
+         (uint8_t *)UIP_FRAG_BUF + UIP_FRAGH_LEN, len);
+
+  /* Update the bitmap. */
+  if(offset >> 6 == (offset + len) >> 6) {
+    c->bitmap[offset >> 6] |=
+      bitmap_bits[(offset >> 3) & 7] &
+      ~bitmap_bits[((offset + len) >> 3)  & 7];
+  } else {
+    /* If the two endpoints are in different bytes, we update the
+       bytes in the endpoints and fill the stuff inbetween with
+       0xff. */
+    c->bitmap[offset >> 6] |= bitmap_bits[(offset >> 3) & 7];
+
+    for(i = (1 + (offset >> 6)); i < ((offset + len) >> 6); ++i) {
+      c->bitmap[i] = 0xff;
     }
+    c->bitmap[(offset + len) >> 6] |=
+      ~bitmap_bits[((offset + len) >> 3) & 7];
+  }
 
-    /* If this fragment has the More Fragments flag set to zero, it is the
-       last fragment*/
-    if((uip_ntohs(UIP_FRAG_BUF->offsetresmore) & IP_MF) == 0) {
-      uip_reassflags |= UIP_REASS_FLAG_LASTFRAG;
-      /*calculate the size of the entire packet*/
-      uip_reasslen = offset + len;
-      PRINTF("LAST FRAGMENT reasslen %d\n", uip_reasslen);
-    } else {
-      /* If len is not a multiple of 8 octets and the M flag of that fragment
-         is 1, then that fragment must be discarded and an ICMP Parameter
-         Problem, Code 0, message should be sent to the source of the fragment,
-         pointing to the Payload Length field of the fragment packet. */
-      if(len % 8 != 0){
-        uip_icmp6_error_output(ICMP6_PARAM_PROB, ICMP6_PARAMPROB_HEADER, 4);
-        uip_reassflags |= UIP_REASS_FLAG_ERROR_MSG;
-        /* not clear if we should interrupt reassembly, but it seems so from
-           the conformance tests */
-        uip_reass_on = 0;
-        etimer_stop(&uip_reass_timer);
-        return uip_len;
+  /* Finally, we check if we have a full packet in the buffer. We do
+     this by checking if we have the last fragment and if all bits
+     in the bitmap are set. */
+
+  if(c->flags & UIP_REASS_FLAG_LASTFRAG) {
+    /* Check all bytes up to and including all but the last byte in
+       the bitmap. */
+    for(i = 0; i < (c->len >> 6); ++i) {
+      if(c->bitmap[i] != 0xff) {
+        return 0;
       }
     }
-    
-    /* Copy the fragment into the reassembly buffer, at the right
-       offset. */
-    memcpy((uint8_t *)FBUF + UIP_IPH_LEN + uip_ext_len + offset,
-           (uint8_t *)UIP_FRAG_BUF + UIP_FRAGH_LEN, len);
-    
-    /* Update the bitmap. */
-    if(offset >> 6 == (offset + len) >> 6) {
-      uip_reassbitmap[offset >> 6] |=
-        bitmap_bits[(offset >> 3) & 7] &
-        ~bitmap_bits[((offset + len) >> 3)  & 7];
-    } else {
-      /* If the two endpoints are in different bytes, we update the
-         bytes in the endpoints and fill the stuff inbetween with
-         0xff. */
-      uip_reassbitmap[offset >> 6] |= bitmap_bits[(offset >> 3) & 7];
- 
-      for(i = (1 + (offset >> 6)); i < ((offset + len) >> 6); ++i) {
-        uip_reassbitmap[i] = 0xff;
-      }
-      uip_reassbitmap[(offset + len) >> 6] |=
-        ~bitmap_bits[((offset + len) >> 3) & 7];
+    /* Check the last byte in the bitmap. It should contain just the
+       right amount of bits. */
+    if(c->bitmap[c->len >> 6] !=
+       (u8_t)~bitmap_bits[(c->len >> 3) & 7]) {
+      return 0;
     }
-  
-    /* Finally, we check if we have a full packet in the buffer. We do
-       this by checking if we have the last fragment and if all bits
-       in the bitmap are set. */
-    
-    if(uip_reassflags & UIP_REASS_FLAG_LASTFRAG) {
-      /* Check all bytes up to and including all but the last byte in
-         the bitmap. */
-      for(i = 0; i < (uip_reasslen >> 6); ++i) {
-        if(uip_reassbitmap[i] != 0xff) {
-          return 0;
-        }
-      }
-      /* Check the last byte in the bitmap. It should contain just the
-         right amount of bits. */
-      if(uip_reassbitmap[uip_reasslen >> 6] !=
-         (u8_t)~bitmap_bits[(uip_reasslen >> 3) & 7]) {
-        return 0;
-      }
 
-     /* If we have come this far, we have a full packet in the
-         buffer, so we copy it to uip_buf. We also reset the timer. */
-      uip_reass_on = 0;
-      etimer_stop(&uip_reass_timer);
-
-      uip_reasslen += UIP_IPH_LEN + uip_ext_len;
-      memcpy(UIP_IP_BUF, FBUF, uip_reasslen);
-      UIP_IP_BUF->len[0] = ((uip_reasslen - UIP_IPH_LEN) >> 8);
-      UIP_IP_BUF->len[1] = ((uip_reasslen - UIP_IPH_LEN) & 0xff);
-      PRINTF("REASSEMBLED PAQUET %d (%d)\n", uip_reasslen,
-             (UIP_IP_BUF->len[0] << 8) | UIP_IP_BUF->len[1]);
-   
-      return uip_reasslen;
-      
-    }
-  } else {
-    PRINTF("Already reassembling another paquet\n");
+    /* If we have come this far, we have a full packet in the
+       buffer, so we copy it to uip_buf. We also free the context. */
+    uip_reass_ctx_free(c);
+    UIP_STAT(++uip_stat.reass.reassembled);
+
+    len = c->len + UIP_IPH_LEN + uip_ext_len;
+    memcpy(UIP_IP_BUF, FBUF(c), len);
+    UIP_IP_BUF->len[0] = ((len - UIP_IPH_LEN) >> 8);
+    UIP_IP_BUF->len[1] = ((len - UIP_IPH_LEN) & 0xff);
+    PRINTF("REASSEMBLED PAQUET %d (%d)\n", len,
+           (UIP_IP_BUF->len[0] << 8) | UIP_IP_BUF->len[1]);
+
+    return len;
   }
   return 0;
 }
@@ -758,31 +895,48 @@ uip_reass(void)
 void
 uip_reass_over(void)
 {
-   /* to late, we abandon the reassembly of the packet */
-
-  uip_reass_on = 0;
-  etimer_stop(&uip_reass_timer);
-
-  if(uip_reassflags & UIP_REASS_FLAG_FIRSTFRAG){
-    PRINTF("FRAG INTERRUPTED TOO LATE\n");
-    /* If the first fragment has been received, an ICMP Time Exceeded
-       -- Fragment Reassembly Time Exceeded message should be sent to the
-       source of that fragment. */
-    /** \note
-     * We don't have a complete packet to put in the error message.
-     * We could include the first fragment but since its not mandated by
-     * any RFC, we decided not to include it as it reduces the size of
-     * the packet.
-     */
-    uip_len = 0;
-    uip_ext_len = 0;
-    memcpy(UIP_IP_BUF, FBUF, UIP_IPH_LEN); /* copy the header for src
-                                              and dest address*/
-    uip_icmp6_error_output(ICMP6_TIME_EXCEEDED, ICMP6_TIME_EXCEED_REASSEMBLY, 0);
-    
-    UIP_STAT(++uip_stat.ip.sent);
-    uip_flags = 0;
+  struct uip_reass_ctx *c;
+  u8_t sent = 0;
+
+  uip_len = 0;
+  for(c = uip_reass_ctxs;
+      c < uip_reass_ctxs + UIP_CONF_IPV6_REASS_NB; c++) {
+    if(!c->on || !timer_expired(&c->timer)) {
+      continue;
+    }
+    if((c->flags & UIP_REASS_FLAG_FIRSTFRAG) && sent) {
+      /* Only one error message fits in uip_buf. The timer is updated
+         to fire again at once for this one. */
+      continue;
+    }
+
+    /* to late, we abandon the reassembly of the packet */
+    c->on = 0;
+    UIP_STAT(++uip_stat.reass.timeout);
+
+    if(c->flags & UIP_REASS_FLAG_FIRSTFRAG){
+      PRINTF("FRAG INTERRUPTED TOO LATE\n");
+      /* If the first fragment has been received, an ICMP Time Exceeded
+         -- Fragment Reassembly Time Exceeded message should be sent to the
+         source of that fragment. */
+      /** \note
+       * We don't have a complete packet to put in the error message.
+       * We could include the first fragment but since its not mandated by
+       * any RFC, we decided not to include it as it reduces the size of
+       * the packet.
+       */
+      uip_len = 0;
+      uip_ext_len = 0;
+      memcpy(UIP_IP_BUF, FBUF(c), UIP_IPH_LEN); /* copy the header for src
+                                                   and dest address*/
+      uip_icmp6_error_output(ICMP6_TIME_EXCEEDED, ICMP6_TIME_EXCEED_REASSEMBLY, 0);
+
+      UIP_STAT(++uip_stat.ip.sent);
+      uip_flags = 0;
+      sent = 1;
+    }
   }
+  uip_reass_timer_update();
 }
 
 #endif /* UIP_CONF_IPV6_REASSEMBLY */
@@ -827,6 +981,13 @@ ext_hdr_options_process() {
         PRINTF("Processing PADN option\n");
         uip_ext_opt_offset += UIP_EXT_HDR_OPT_PADN_BUF->opt_len + 2;
         break;
+#if UIP_CONF_IPV6_MULTICAST
+      case UIP_EXT_HDR_OPT_MPL:
+        /* already handled by uip_mpl_in() */
+        PRINTF("Processing MPL option\n");
+        uip_ext_opt_offset += UIP_EXT_HDR_OPT_BUF->len + 2;
+        break;
+#endif /* UIP_CONF_IPV6_MULTICAST */
       default:
         /*
          * check the two highest order bits of the option
@@ -1077,6 +1238,15 @@ uip_process(u8_t flag)
     goto drop;
   }
 
+#if UIP_CONF_IPV6_MULTICAST
+  /* Realm-local multicast is forwarded through the mesh by MPL, and
+     passed up only once and only if we are a member of the group */
+  if(uip_mpl_is_addr_realm(&UIP_IP_BUF->destipaddr) &&
+     uip_mpl_in() == UIP_MPL_DROP) {
+    goto drop;
+  }
+#endif /* UIP_CONF_IPV6_MULTICAST */
+
 #if UIP_CONF_ROUTER
   /* TBD Some Parameter problem messages */
   if(!uip_ds6_is_my_addr(&UIP_IP_BUF->destipaddr) &&
@@ -1397,9 +1567,15 @@ uip_process(u8_t flag)
   }
 
   /* Demultiplex this UDP packet between the UDP "connections". */
+#if UIP_CONN_HASH
+  for(uip_udp_conn = udp_hash[UDP_HASH(UIP_UDP_BUF->destport)];
+      uip_udp_conn != NULL;
+      uip_udp_conn = uip_udp_conn->hnext) {
+#else /* UIP_CONN_HASH */
   for(uip_udp_conn = &uip_udp_conns[0];
       uip_udp_conn < &uip_udp_conns[UIP_UDP_CONNS];
       ++uip_udp_conn) {
+#endif /* UIP_CONN_HASH */
     /* If the local UDP port is non-zero, the connection is considered
        to be used. If so, the local port number is checked against the
        destination port number in the received packet. If the two port
@@ -1497,8 +1673,15 @@ uip_process(u8_t flag)
 
   /* Demultiplex this segment. */
   /* First check any active connections. */
+#if UIP_CONN_HASH
+  for(uip_connr = tcp_hash[TCP_HASH(UIP_TCP_BUF->destport,
+                                    UIP_TCP_BUF->srcport,
+                                    &UIP_IP_BUF->srcipaddr)];
+      uip_connr != NULL; uip_connr = uip_connr->hnext) {
+#else /* UIP_CONN_HASH */
   for(uip_connr = &uip_conns[0]; uip_connr <= &uip_conns[UIP_CONNS - 1];
       ++uip_connr) {
+#endif /* UIP_CONN_HASH */
     if(uip_connr->tcpstateflags != UIP_CLOSED &&
        UIP_TCP_BUF->destport == uip_connr->lport &&
        UIP_TCP_BUF->srcport == uip_connr->rport &&
@@ -1618,9 +1801,8 @@ uip_process(u8_t flag)
   uip_connr->sa = 0;
   uip_connr->sv = 4;
   uip_connr->nrtx = 0;
-  uip_connr->lport = UIP_TCP_BUF->destport;
-  uip_connr->rport = UIP_TCP_BUF->srcport;
-  uip_ipaddr_copy(&uip_connr->ripaddr, &UIP_IP_BUF->srcipaddr);
+  tcp_conn_set(uip_connr, UIP_TCP_BUF->destport, UIP_TCP_BUF->srcport,
+               &UIP_IP_BUF->srcipaddr);
   uip_connr->tcpstateflags = UIP_SYN_RCVD;
 
   uip_connr->snd_nxt[0] = iss[0];
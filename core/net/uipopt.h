@@ -204,6 +204,17 @@
 #define UIP_CONF_IPV6_REASSEMBLY      0
 #endif
 
+#ifndef UIP_CONF_IPV6_REASS_NB
+/** How many fragmented packets can be reassembled at the same time,
+    each needing a buffer of the size of uip_buf (default: 2) */
+#define UIP_CONF_IPV6_REASS_NB        2
+#endif
+
+#ifndef UIP_CONF_IPV6_MULTICAST
+/** Do we forward realm-local multicast packets with MPL (default: no) */
+#define UIP_CONF_IPV6_MULTICAST       0
+#endif
+
 #ifndef UIP_CONF_NETIF_MAX_ADDRESSES
 /** Default number of IPv6 addresses associated to the node's interface */
 #define UIP_CONF_NETIF_MAX_ADDRESSES  3
@@ -272,6 +283,22 @@
 #define UIP_UDP_CONNS    10
 #endif /* UIP_CONF_UDP_CONNS */
 
+/**
+ * The number of hash buckets used to find the connection an incoming
+ * UDP datagram or TCP segment belongs to, in each of the UDP and TCP
+ * tables. UDP connections are hashed on their local port only, since
+ * the remote port and address may be left open. With 0 (the
+ * default) all connections are scanned, which is smaller and as fast
+ * when there are only a few of them.
+ *
+ * \hideinitializer
+ */
+#ifdef UIP_CONF_CONN_HASH
+#define UIP_CONN_HASH (UIP_CONF_CONN_HASH)
+#else /* UIP_CONF_CONN_HASH */
+#define UIP_CONN_HASH    0
+#endif /* UIP_CONF_CONN_HASH */
+
 /**
  * The name of the function that should be called when UDP datagrams arrive.
  *
@@ -102,8 +102,9 @@ collect_common_send(void)
   struct {
     uint8_t seqno;
     uint8_t for_alignment;
-    struct collect_view_data_msg msg;
+    uint8_t report[COLLECT_VIEW_REPORT_MAX_LEN];
   } msg;
+  int len;
   /* struct collect_neighbor *n; */
   uint16_t parent_etx;
   uint16_t rtmetric;
@@ -149,11 +150,14 @@ collect_common_send(void)
   }
 
   /* num_neighbors = collect_neighbor_list_num(&tc.neighbor_list); */
-  collect_view_construct_message(&msg.msg, &parent,
-                                 parent_etx, rtmetric,
-                                 num_neighbors, beacon_interval);
+  len = collect_view_construct_report(msg.report, sizeof(msg.report),
+                                      &parent, parent_etx, rtmetric,
+                                      num_neighbors, beacon_interval);
+  if(len == 0) {
+    return;
+  }
 
-  uip_udp_packet_sendto(client_conn, &msg, sizeof(msg),
+  uip_udp_packet_sendto(client_conn, &msg, 2 + len,
                         &server_ipaddr, UIP_HTONS(UDP_SERVER_PORT));
 }
 /*---------------------------------------------------------------------------*/
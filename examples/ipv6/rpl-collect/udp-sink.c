@@ -48,6 +48,7 @@
 #include <ctype.h>
 #include "collect-common.h"
 #include "collect-view.h"
+#include "collect-view-codec.h"
 
 #define DEBUG DEBUG_PRINT
 #include "net/uip-debug.h"
@@ -99,13 +100,27 @@ tcpip_handler(void)
   rimeaddr_t sender;
   uint8_t seqno;
   uint8_t hops;
+  struct collect_view_data_msg msg;
 
   if(uip_newdata()) {
     appdata = (uint8_t *)uip_appdata;
+    rimeaddr_copy(&sender, &rimeaddr_null);
     sender.u8[0] = UIP_IP_BUF->srcipaddr.u8[15];
     sender.u8[1] = UIP_IP_BUF->srcipaddr.u8[14];
     seqno = *appdata;
     hops = uip_ds6_if.cur_hop_limit - UIP_IP_BUF->ttl + 1;
+    /* Senders built with COLLECT_VIEW_CONF_COMPACT send compact
+       reports, which are turned back into full reports here. */
+    if(uip_datalen() > 2 &&
+       (appdata[2] == COLLECT_VIEW_KEYFRAME ||
+        appdata[2] == COLLECT_VIEW_DELTA)) {
+      if(collect_view_decode_report(&sender, appdata + 2,
+                                    uip_datalen() - 2, &msg)) {
+        collect_common_recv(&sender, seqno, hops,
+                            (uint8_t *)&msg, sizeof(msg));
+      }
+      return;
+    }
     collect_common_recv(&sender, seqno, hops,
                         appdata + 2, uip_datalen() - 2);
   }
@@ -71,13 +71,22 @@ httpd_cgi(char *name)
 {
   struct httpd_cgi_call *f;
 
-  /* Find the matching name in the table, return the function. */
+  f = httpd_cgi_find(name);
+  return f != NULL ? f->function : nullfunction;
+}
+/*---------------------------------------------------------------------------*/
+struct httpd_cgi_call *
+httpd_cgi_find(char *name)
+{
+  struct httpd_cgi_call *f;
+
+  /* Find the matching name in the table. */
   for(f = calls; f != NULL; f = f->next) {
     if(strncmp(f->name, name, strlen(f->name)) == 0) {
-      return f->function;
+      return f;
     }
   }
-  return nullfunction;
+  return NULL;
 }
 /*---------------------------------------------------------------------------*/
 static
@@ -259,8 +268,8 @@ received_announcement(struct announcement *a, const rimeaddr_t *from,
   { adv_received, NULL};*/
 
 
-HTTPD_CGI_CALL(sensors, "sensors", sensorscall);
-HTTPD_CGI_CALL(nodeid, "nodeid", nodeidcall);
+HTTPD_CGI_CALL_TTL(sensors, "sensors", sensorscall, 1);
+HTTPD_CGI_CALL_TTL(nodeid, "nodeid", nodeidcall, 3600);
 //HTTPD_CGI_CALL(neighbors, "neighbors", neighborscall);
 
 /*static struct neighbor_discovery_conn conn;*/
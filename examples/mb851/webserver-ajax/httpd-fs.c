@@ -37,6 +37,7 @@
 #include "httpd.h"
 #include "httpd-fs.h"
 #include "httpd-fsdata.h"
+#include "httpd-cgi.h"
 
 #include "httpd-fsdata.c"
 
@@ -44,6 +45,14 @@
 static u16_t count[HTTPD_FS_NUMFILES];
 #endif /* HTTPD_FS_STATISTICS */
 
+#ifndef HTTPD_FS_NUMSCRIPTS
+#define HTTPD_FS_NUMSCRIPTS 0
+#endif /* HTTPD_FS_NUMSCRIPTS */
+
+#if HTTPD_FS_NUMSCRIPTS > 0
+static struct httpd_cgi_call *scripts[HTTPD_FS_NUMSCRIPTS];
+#endif /* HTTPD_FS_NUMSCRIPTS > 0 */
+
 /*-----------------------------------------------------------------------------------*/
 static u8_t
 httpd_fs_strcmp(const char *str1, const char *str2)
@@ -81,6 +90,7 @@ httpd_fs_open(const char *name, struct httpd_fs_file *file)
     if(httpd_fs_strcmp(name, f->name) == 0) {
       file->data = f->data;
       file->len = f->len - 1;
+      file->segments = f->segments;
 #if HTTPD_FS_STATISTICS
       ++count[i];
 #endif /* HTTPD_FS_STATISTICS */
@@ -94,6 +104,19 @@ httpd_fs_open(const char *name, struct httpd_fs_file *file)
   return 0;
 }
 /*-----------------------------------------------------------------------------------*/
+struct httpd_cgi_call *
+httpd_fs_script(unsigned char index)
+{
+#if HTTPD_FS_NUMSCRIPTS > 0
+  if(scripts[index] == NULL) {
+    scripts[index] = httpd_cgi_find((char *)httpd_fsdata_scripts[index]);
+  }
+  return scripts[index];
+#else /* HTTPD_FS_NUMSCRIPTS > 0 */
+  return NULL;
+#endif /* HTTPD_FS_NUMSCRIPTS > 0 */
+}
+/*-----------------------------------------------------------------------------------*/
 void
 httpd_fs_init(void)
 {
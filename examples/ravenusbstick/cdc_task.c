@@ -629,6 +629,7 @@ extern void jackdaw_choose_rdc_driver(uint8_t i);
 				for (i = 0; i < UIP_DS6_ROUTE_NB; i++) {
 					uip_ds6_routing_table[i].isused=0;
                 }
+                uip_ds6_gen++;
                 PRINTF_P(PSTR("Routing table cleared!\n\r")); 
                 break;
             }
@@ -68,13 +68,22 @@ httpd_cgi(char *name)
 {
   struct httpd_cgi_call *f;
 
-  /* Find the matching name in the table, return the function. */
+  f = httpd_cgi_find(name);
+  return f != NULL ? f->function : nullfunction;
+}
+/*---------------------------------------------------------------------------*/
+struct httpd_cgi_call *
+httpd_cgi_find(char *name)
+{
+  struct httpd_cgi_call *f;
+
+  /* Find the matching name in the table. */
   for(f = calls; f != NULL; f = f->next) {
     if(strncmp(f->name, name, strlen(f->name)) == 0) {
-      return f->function;
+      return f;
     }
   }
-  return nullfunction;
+  return NULL;
 }
 /*---------------------------------------------------------------------------*/
 static
@@ -201,6 +210,9 @@ PT_THREAD(neighborscall(struct httpd_state *s, char *ptr))
   PSOCK_END(&s->sout);
 }
 /*---------------------------------------------------------------------------*/
+HTTPD_CGI_CALL_TTL(sensors, "sensors", sensorscall, 1);
+HTTPD_CGI_CALL_TTL(nodeid, "nodeid", nodeidcall, 3600);
+HTTPD_CGI_CALL_TTL(neighbors, "neighbors", neighborscall, 30);
 
 static void
 received_announcement(struct announcement *a, const rimeaddr_t *from,
@@ -217,6 +229,7 @@ received_announcement(struct announcement *a, const rimeaddr_t *from,
   } else {
     collect_neighbor_update(n, value);
   }
+  httpd_cgi_changed(&neighbors);
 }
 
 
@@ -224,10 +237,6 @@ received_announcement(struct announcement *a, const rimeaddr_t *from,
   { adv_received, NULL};*/
 
 
-HTTPD_CGI_CALL(sensors, "sensors", sensorscall);
-HTTPD_CGI_CALL(nodeid, "nodeid", nodeidcall);
-HTTPD_CGI_CALL(neighbors, "neighbors", neighborscall);
-
 /*static struct neighbor_discovery_conn conn;*/
 static struct announcement announcement;
 
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/*
+ * Produce a patch that turns an installed code module into a new
+ * one, for sending with codeprop instead of the full module. See
+ * apps/codeprop/codeprop-patch.h for the format.
+ *
+ * usage: codeprop-diff oldmodule newmodule patchfile
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Should be included from codeprop-patch.h, but the include paths in
+   the makefiles isn't set up for that. */
+#define MAGIC "\177PT\001"
+#define HDR_SIZE 12
+#define OP_COPY  0x80
+#define MIN_COPY 4
+#define MAX_COPY (0x7f + MIN_COPY)
+#define MAX_ADD  0x80
+
+#define MAX_SIZE 0xffff
+
+#define HASH_BITS 12
+#define HASH(p) ((((p)[0] << 9) ^ ((p)[1] << 6) ^ ((p)[2] << 3) ^ (p)[3]) & \
+                 ((1 << HASH_BITS) - 1))
+#define MAX_CHAIN 256
+
+static unsigned char *old, *new;
+static long old_len, new_len;
+static int head[1 << HASH_BITS];
+static int *chain;
+
+static unsigned char *out;
+static long out_len;
+
+/*---------------------------------------------------------------------------*/
+static unsigned char *
+read_file(const char *name, long *len)
+{
+  FILE *f;
+  unsigned char *buf;
+
+  if((f = fopen(name, "rb")) == NULL) {
+    perror(name);
+    exit(1);
+  }
+  buf = malloc(MAX_SIZE + 1);
+  *len = fread(buf, 1, MAX_SIZE + 1, f);
+  fclose(f);
+  if(*len > MAX_SIZE) {
+    fprintf(stderr, "%s: modules larger than %d bytes are not supported\n",
+            name, MAX_SIZE);
+    exit(1);
+  }
+  return buf;
+}
+/*---------------------------------------------------------------------------*/
+/* The same CRC as crc16_data() in core/lib/crc16.c. */
+static unsigned short
+crc16(const unsigned char *data, long len)
+{
+  unsigned short acc = 0;
+
+  while(len-- > 0) {
+    acc ^= *data++;
+    acc  = (acc >> 8) | (acc << 8);
+    acc ^= (acc & 0xff00) << 4;
+    acc ^= (acc >> 8) >> 4;
+    acc ^= (acc & 0xff00) >> 5;
+  }
+  return acc;
+}
+/*---------------------------------------------------------------------------*/
+static void
+put_u16(unsigned int v)
+{
+  out[out_len++] = v >> 8;
+  out[out_len++] = v & 0xff;
+}
+/*---------------------------------------------------------------------------*/
+static void
+flush_add(long start, long end)
+{
+  long len;
+
+  while(start < end) {
+    len = end - start > MAX_ADD ? MAX_ADD : end - start;
+    out[out_len++] = len - 1;
+    memcpy(&out[out_len], &new[start], len);
+    out_len += len;
+    start += len;
+  }
+}
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char **argv)
+{
+  FILE *f;
+  long i, pos, add_start;
+  long best_len, best_off, len;
+  int c, n, copies, adds;
+
+  if(argc != 4) {
+    fprintf(stderr, "usage: %s oldmodule newmodule patchfile\n", argv[0]);
+    exit(1);
+  }
+  old = read_file(argv[1], &old_len);
+  new = read_file(argv[2], &new_len);
+
+  /* Index every MIN_COPY byte sequence in the old module. */
+  chain = malloc(sizeof(int) * (old_len + 1));
+  memset(head, -1, sizeof(head));
+  for(i = 0; i + MIN_COPY <= old_len; i++) {
+    chain[i] = head[HASH(&old[i])];
+    head[HASH(&old[i])] = i;
+  }
+
+  /* The worst case is one ADD op for every MAX_ADD bytes. */
+  out = malloc(HDR_SIZE + new_len + new_len / MAX_ADD + 1);
+  memcpy(out, MAGIC, 4);
+  out_len = 4;
+  put_u16(old_len);
+  put_u16(crc16(old, old_len));
+  put_u16(new_len);
+  put_u16(crc16(new, new_len));
+
+  copies = adds = 0;
+  add_start = 0;
+  pos = 0;
+  while(pos < new_len) {
+    best_len = 0;
+    best_off = 0;
+    if(pos + MIN_COPY <= new_len) {
+      for(c = head[HASH(&new[pos])], n = 0;
+          c >= 0 && n < MAX_CHAIN;
+          c = chain[c], n++) {
+        for(len = 0;
+            c + len < old_len && pos + len < new_len &&
+              old[c + len] == new[pos + len];
+            len++);
+        if(len > best_len) {
+          best_len = len;
+          best_off = c;
+        }
+      }
+    }
+
+    if(best_len < MIN_COPY) {
+      pos++;
+      continue;
+    }
+
+    if(add_start < pos) {
+      adds++;
+    }
+    flush_add(add_start, pos);
+    while(best_len >= MIN_COPY) {
+      len = best_len > MAX_COPY ? MAX_COPY : best_len;
+      out[out_len++] = OP_COPY | (len - MIN_COPY);
+      put_u16(best_off);
+      best_off += len;
+      best_len -= len;
+      pos += len;
+      copies++;
+    }
+    /* A tail shorter than MIN_COPY is sent as literal bytes. */
+    add_start = pos;
+  }
+  if(add_start < pos) {
+    adds++;
+  }
+  flush_add(add_start, new_len);
+
+  if((f = fopen(argv[3], "wb")) == NULL) {
+    perror(argv[3]);
+    exit(1);
+  }
+  fwrite(out, 1, out_len, f);
+  fclose(f);
+
+  printf("%s: %ld bytes, %ld byte module (%d copies, %d literal runs), "
+         "%ld%% of full size\n",
+         argv[3], out_len, new_len, copies, adds,
+         new_len > 0 ? out_len * 100 / new_len : 0);
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,470 @@
+/*
+ * Copyright (c) 2011, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/*
+ * Convert an ELF object file into the streamable module layout that
+ * core/loader/elfloader-stream.c loads while the module is being
+ * received. See core/loader/elfloader-stream.h for the format.
+ *
+ * The external symbols are listed first, local symbols are resolved
+ * here, and each relocation is placed in the segment data at the
+ * offset it applies to, so the loader never has to go back in the
+ * stream.
+ *
+ * usage: elf2stream module.ce module.cs
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Should be included from elfloader-stream.h, but the include paths
+   in the makefiles isn't set up for that. */
+#define MAGIC "\177CS\001"
+#define HDR_SIZE 16
+#define OP_DATA    0
+#define OP_ABS16   1
+#define OP_ABS32   2
+#define OP_PCREL32 3
+#define SEG_TEXT   1
+#define SEG_RODATA 2
+#define SEG_DATA   3
+#define SEG_BSS    4
+#define TARGET_SEGMENT 0xf0
+#define MAX_NAME 29
+
+#define EM_386        3
+#define EM_MSP430     105
+#define EM_MSP430_OLD 0x1059
+
+#define SHT_SYMTAB 2
+#define SHT_RELA   4
+#define SHT_REL    9
+
+#define R_386_NONE 0
+#define R_386_32   1
+#define R_386_PC32 2
+
+struct reloc {
+  unsigned long offset;
+  int op;
+  int target;
+  long addend;
+};
+
+static unsigned char *elf;
+static long elf_len;
+
+#define MAX_SECTIONS 256
+
+/* Each .text*, .rodata*, .data*, and .bss* section is placed in its
+   segment at sect_base[]. */
+static int sect_seg[MAX_SECTIONS];
+static unsigned long sect_base[MAX_SECTIONS];
+static unsigned long segsize[SEG_BSS + 1];
+static unsigned long segalign[SEG_BSS + 1] = {1, 1, 1, 1, 1};
+static unsigned char *segimage[SEG_BSS + 1];
+static int symtab_sect = -1;
+
+static const char *syms[TARGET_SEGMENT];
+static int nsyms;
+
+static unsigned char *out;
+static long out_len;
+static long nrelocs;
+
+/*---------------------------------------------------------------------------*/
+static unsigned long
+get(unsigned long offset, int size)
+{
+  unsigned long v = 0;
+
+  if(offset + size > (unsigned long)elf_len) {
+    fprintf(stderr, "elf2stream: truncated ELF file\n");
+    exit(1);
+  }
+  while(size-- > 0) {
+    v = (v << 8) | elf[offset + size];
+  }
+  return v;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long shoff, shentsize;
+
+#define SH(i, field)   get(shoff + (i) * shentsize + (field), 4)
+#define SH_NAME      0
+#define SH_TYPE      4
+#define SH_OFFSET    16
+#define SH_SIZE      20
+#define SH_LINK      24
+#define SH_INFO      28
+/*---------------------------------------------------------------------------*/
+static void
+put(unsigned long v, int size)
+{
+  while(size-- > 0) {
+    out[out_len++] = v & 0xff;
+    v >>= 8;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+segment_of_section(int shndx)
+{
+  return shndx > 0 && shndx < MAX_SECTIONS ? sect_seg[shndx] : 0;
+}
+/*---------------------------------------------------------------------------*/
+static const char *
+symbol(unsigned long index, unsigned long *value, int *shndx)
+{
+  unsigned long sym, strtab;
+
+  sym = SH(symtab_sect, SH_OFFSET) + index * 16;
+  strtab = SH(SH(symtab_sect, SH_LINK), SH_OFFSET);
+  *value = get(sym + 4, 4);
+  *shndx = get(sym + 14, 2);
+  return (const char *)&elf[strtab + get(sym, 4)];
+}
+/*---------------------------------------------------------------------------*/
+static int
+add_symbol(const char *name)
+{
+  int i;
+
+  for(i = 0; i < nsyms; i++) {
+    if(strcmp(syms[i], name) == 0) {
+      return i;
+    }
+  }
+  if(nsyms == TARGET_SEGMENT || strlen(name) > MAX_NAME) {
+    fprintf(stderr, "elf2stream: too many or too long symbols (%s)\n", name);
+    exit(1);
+  }
+  syms[nsyms] = name;
+  return nsyms++;
+}
+/*---------------------------------------------------------------------------*/
+static int
+compare_relocs(const void *a, const void *b)
+{
+  const struct reloc *ra = a, *rb = b;
+
+  return ra->offset < rb->offset ? -1 : ra->offset > rb->offset;
+}
+/*---------------------------------------------------------------------------*/
+static int
+read_relocs(int relsect, int machine, struct reloc *r)
+{
+  unsigned long base, entsize, info, value, offset;
+  int i, n, num, type, shndx, target, seg;
+  const char *name;
+
+  entsize = SH(relsect, SH_TYPE) == SHT_RELA ? 12 : 8;
+  n = SH(relsect, SH_SIZE) / entsize;
+  seg = segment_of_section(SH(relsect, SH_INFO));
+  if(seg == 0 || seg == SEG_BSS) {
+    /* Relocations for sections that are not loaded. */
+    return 0;
+  }
+
+  num = 0;
+  for(i = 0; i < n; i++) {
+    base = SH(relsect, SH_OFFSET) + i * entsize;
+    offset = get(base, 4);
+    info = get(base + 4, 4);
+    type = info & 0xff;
+
+    r[num].offset = sect_base[SH(relsect, SH_INFO)] + offset;
+    if(machine == EM_386) {
+      if(type == R_386_NONE) {
+        continue;
+      } else if(type == R_386_32) {
+        r[num].op = OP_ABS32;
+      } else if(type == R_386_PC32) {
+        r[num].op = OP_PCREL32;
+      } else {
+        fprintf(stderr, "elf2stream: unsupported relocation type %d\n", type);
+        exit(1);
+      }
+    } else {
+      /* elfloader-msp430.c treats all relocations as 16-bit absolute. */
+      r[num].op = OP_ABS16;
+    }
+
+    if(entsize == 12) {
+      r[num].addend = (long)(int)get(base + 8, 4);
+    } else if(r[num].op == OP_ABS16) {
+      /* The addend is stored in the section data. */
+      r[num].addend = (short)(segimage[seg][r[num].offset] |
+                              (segimage[seg][r[num].offset + 1] << 8));
+    } else {
+      r[num].addend = (long)(int)(segimage[seg][r[num].offset] |
+                                  (segimage[seg][r[num].offset + 1] << 8) |
+                                  (segimage[seg][r[num].offset + 2] << 16) |
+                                  ((unsigned long)segimage[seg][r[num].offset + 3] << 24));
+    }
+
+    name = symbol(info >> 8, &value, &shndx);
+    target = segment_of_section(shndx);
+    if(target != 0) {
+      /* A local symbol or a section: resolved here. */
+      r[num].target = TARGET_SEGMENT + target;
+      r[num].addend += sect_base[shndx] + value;
+    } else if(shndx == 0 && name[0] != 0) {
+      r[num].target = add_symbol(name);
+    } else {
+      fprintf(stderr, "elf2stream: symbol '%s' in unsupported section %d\n",
+              name, shndx);
+      exit(1);
+    }
+    num++;
+  }
+  return num;
+}
+/*---------------------------------------------------------------------------*/
+static void
+put_data(int seg, unsigned long from, unsigned long to)
+{
+  unsigned long len;
+
+  while(from < to) {
+    len = to - from > 255 ? 255 : to - from;
+    put(OP_DATA, 1);
+    put(len, 1);
+    memcpy(&out[out_len], &segimage[seg][from], len);
+    out_len += len;
+    from += len;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+put_segment(int seg, struct reloc *r, int num)
+{
+  unsigned long pos;
+  int i;
+
+  pos = 0;
+  for(i = 0; i < num; i++) {
+    if(r[i].offset < pos) {
+      fprintf(stderr, "elf2stream: overlapping relocations\n");
+      exit(1);
+    }
+    put_data(seg, pos, r[i].offset);
+    put(r[i].op, 1);
+    put(r[i].target, 1);
+    put(r[i].addend, 4);
+    pos = r[i].offset + (r[i].op == OP_ABS16 ? 2 : 4);
+    nrelocs++;
+  }
+  put_data(seg, pos, segsize[seg]);
+}
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char **argv)
+{
+  FILE *f;
+  unsigned long shstrtab, value, align, nsymbols, type;
+  unsigned long autostart_off;
+  int i, seg, machine, shnum, shndx, autostart_seg, hdr_len;
+  const char *name;
+  struct reloc *relocs[SEG_BSS + 1];
+  int nrel[SEG_BSS + 1];
+  static const char *segnames[] = {NULL, ".text", ".rodata", ".data", ".bss"};
+
+  if(argc != 3) {
+    fprintf(stderr, "usage: %s module.ce module.cs\n", argv[0]);
+    exit(1);
+  }
+
+  if((f = fopen(argv[1], "rb")) == NULL) {
+    perror(argv[1]);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  elf_len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  elf = malloc(elf_len);
+  if(fread(elf, 1, elf_len, f) != (size_t)elf_len) {
+    perror(argv[1]);
+    exit(1);
+  }
+  fclose(f);
+
+  if(elf_len < 52 || memcmp(elf, "\177ELF\001\001\001", 7) != 0) {
+    fprintf(stderr, "%s: not a 32-bit little endian ELF file\n", argv[1]);
+    exit(1);
+  }
+  machine = get(18, 2);
+  if(machine != EM_386 && machine != EM_MSP430 && machine != EM_MSP430_OLD) {
+    fprintf(stderr, "%s: unsupported machine %d\n", argv[1], machine);
+    exit(1);
+  }
+  shoff = get(32, 4);
+  shentsize = get(46, 2);
+  shnum = get(48, 2);
+  shstrtab = SH(get(50, 2), SH_OFFSET);
+  if(shnum > MAX_SECTIONS) {
+    fprintf(stderr, "%s: too many sections\n", argv[1]);
+    exit(1);
+  }
+
+  /* Lay out the sections in their segments. Unlike elfloader_load(),
+     several sections may go into one segment, e.g. .rodata and
+     .rodata.str1.1. */
+  for(i = 1; i < shnum; i++) {
+    name = (const char *)&elf[shstrtab + SH(i, SH_NAME)];
+    type = SH(i, SH_TYPE);
+    if(type == SHT_SYMTAB) {
+      symtab_sect = i;
+      continue;
+    }
+    if(type == SHT_REL || type == SHT_RELA) {
+      continue;
+    }
+    for(seg = SEG_TEXT; seg <= SEG_BSS; seg++) {
+      if(strncmp(name, segnames[seg], strlen(segnames[seg])) == 0 &&
+         SH(i, SH_SIZE) > 0) {
+        align = get(shoff + i * shentsize + 32, 4);
+        if(align > 1) {
+          segsize[seg] = (segsize[seg] + align - 1) & ~(align - 1);
+          if(align > segalign[seg]) {
+            segalign[seg] = align;
+          }
+        }
+        sect_seg[i] = seg;
+        sect_base[i] = segsize[seg];
+        segsize[seg] += SH(i, SH_SIZE);
+        break;
+      }
+    }
+  }
+  /* The loader places .rodata right after .text and .data right after
+     .bss, so pad those to keep the following segment aligned. */
+  segsize[SEG_TEXT] = (segsize[SEG_TEXT] + segalign[SEG_RODATA] - 1) &
+    ~(segalign[SEG_RODATA] - 1);
+  segsize[SEG_BSS] = (segsize[SEG_BSS] + segalign[SEG_DATA] - 1) &
+    ~(segalign[SEG_DATA] - 1);
+
+  if(symtab_sect < 0) {
+    fprintf(stderr, "%s: no symbol table\n", argv[1]);
+    exit(1);
+  }
+  if(segsize[SEG_TEXT] == 0) {
+    fprintf(stderr, "%s: no .text\n", argv[1]);
+    exit(1);
+  }
+  for(seg = SEG_TEXT; seg <= SEG_BSS; seg++) {
+    if(segsize[seg] > 0xffff) {
+      fprintf(stderr, "%s: %s too large\n", argv[1], segnames[seg]);
+      exit(1);
+    }
+    segimage[seg] = calloc(1, segsize[seg] + 4);
+  }
+  for(i = 1; i < shnum; i++) {
+    if(sect_seg[i] != 0 && sect_seg[i] != SEG_BSS) {
+      memcpy(&segimage[sect_seg[i]][sect_base[i]],
+             &elf[SH(i, SH_OFFSET)], SH(i, SH_SIZE));
+    }
+  }
+
+  /* Find the autostart processes. */
+  autostart_seg = 0;
+  autostart_off = 0;
+  nsymbols = SH(symtab_sect, SH_SIZE) / 16;
+  for(i = 0; i < (int)nsymbols; i++) {
+    name = symbol(i, &value, &shndx);
+    if(strcmp(name, "autostart_processes") == 0 &&
+       segment_of_section(shndx) != 0) {
+      autostart_seg = segment_of_section(shndx);
+      autostart_off = sect_base[shndx] + value;
+    }
+  }
+  if(autostart_seg == 0) {
+    fprintf(stderr, "%s: warning: no autostart_processes\n", argv[1]);
+  }
+
+  /* Collect the relocations of each segment, sorted by offset. */
+  for(seg = SEG_TEXT; seg <= SEG_BSS; seg++) {
+    relocs[seg] = malloc(sizeof(struct reloc) * (elf_len / 8 + 1));
+    nrel[seg] = 0;
+  }
+  for(i = 1; i < shnum; i++) {
+    type = SH(i, SH_TYPE);
+    if(type == SHT_REL || type == SHT_RELA) {
+      seg = segment_of_section(SH(i, SH_INFO));
+      if(seg != 0) {
+        nrel[seg] += read_relocs(i, machine, &relocs[seg][nrel[seg]]);
+      }
+    }
+  }
+  for(seg = SEG_TEXT; seg <= SEG_DATA; seg++) {
+    qsort(relocs[seg], nrel[seg], sizeof(struct reloc), compare_relocs);
+  }
+
+  /* Worst case: DATA records of one byte, plus the relocations. */
+  out = malloc(HDR_SIZE + 32 * nsyms + 3 * elf_len +
+               segsize[SEG_TEXT] + segsize[SEG_RODATA] + segsize[SEG_DATA] +
+               6 * (nrel[SEG_TEXT] + nrel[SEG_RODATA] + nrel[SEG_DATA]));
+  memcpy(out, MAGIC, 4);
+  out_len = 4;
+  put(segsize[SEG_TEXT], 2);
+  put(segsize[SEG_RODATA], 2);
+  put(segsize[SEG_DATA], 2);
+  put(segsize[SEG_BSS], 2);
+  put(nsyms, 1);
+  put(autostart_seg, 1);
+  put(autostart_off, 2);
+  for(i = 0; i < nsyms; i++) {
+    put(strlen(syms[i]), 1);
+    memcpy(&out[out_len], syms[i], strlen(syms[i]));
+    out_len += strlen(syms[i]);
+  }
+  hdr_len = out_len;
+  for(seg = SEG_TEXT; seg <= SEG_DATA; seg++) {
+    put_segment(seg, relocs[seg], nrel[seg]);
+  }
+
+  if((f = fopen(argv[2], "wb")) == NULL) {
+    perror(argv[2]);
+    exit(1);
+  }
+  fwrite(out, 1, out_len, f);
+  fclose(f);
+
+  printf("%s: %ld bytes (ELF %ld bytes), %d symbols, %ld relocations, "
+         "header %d bytes\n"
+         "  text %lu rodata %lu data %lu bss %lu\n",
+         argv[2], out_len, elf_len, nsyms, nrelocs, hdr_len,
+         segsize[SEG_TEXT], segsize[SEG_RODATA], segsize[SEG_DATA],
+         segsize[SEG_BSS]);
+  return 0;
+}
+/*---------------------------------------------------------------------------*/